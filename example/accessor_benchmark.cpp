@@ -0,0 +1,130 @@
+#include <grid_map/GridMap.hpp>
+#include <grid_map/LayerAccessor.hpp>
+#include <grid_map/operators/Inflation.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+#include <vector>
+
+// Compares the throwing GridMap accessors with the bounds-policy accessors of
+// LayerAccessor.hpp. The position workload samples points along rays cast from
+// the map center that leave the map, such that a large part of the queries miss.
+
+namespace {
+
+typedef std::chrono::high_resolution_clock Clock;
+
+template<typename Function>
+double measureNs(Function function, size_t nQueries, unsigned& checksum)
+{
+    const auto start = Clock::now();
+    checksum += function();
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / nQueries;
+}
+
+template<typename BoundsPolicy>
+unsigned sumAtPositions(const grid_map::GridMap& map, const std::vector<grid_map::Position>& positions)
+{
+    grid_map::LayerAccessor<BoundsPolicy> accessor(map, "layer");
+    unsigned sum = 0;
+    for (const auto& position : positions) {
+        sum += accessor.valueAtPositionOr(position, grid_map::NO_INFORMATION);
+    }
+    return sum;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    const int nRays = argc > 1 ? std::atoi(argv[1]) : 2000;
+    grid_map::GridMap map({"layer"});
+    map.setGeometry(grid_map::Length(10.0, 10.0), 0.02, grid_map::Position(0.0, 0.0));
+    map.add("layer", grid_map::FREE_SPACE);
+    map.get("layer").setRandom();
+    map.move(grid_map::Position(1.3, -0.7)); // Exercise the circular buffer.
+
+    // Rays of 8 m length from the map center, sampled at half the resolution.
+    std::vector<grid_map::Position> positions;
+    for (int k = 0; k < nRays; ++k) {
+        const double angle = 2.0 * M_PI * k / nRays;
+        const grid_map::Vector direction(std::cos(angle), std::sin(angle));
+        for (double range = 0.0; range < 8.0; range += 0.01) {
+            positions.push_back(map.getPosition() + range * direction);
+        }
+    }
+    size_t nInside = 0;
+    for (const auto& position : positions) nInside += map.isInside(position) ? 1 : 0;
+    std::printf("%zu position queries, %.1f%% outside of the map\n", positions.size(),
+                100.0 * (positions.size() - nInside) / positions.size());
+
+    unsigned checksum = 0;
+    const grid_map::GridMap& constMap = map;
+    std::printf("atPosition + catch          %7.2f ns/query\n", measureNs([&]() {
+        unsigned sum = 0;
+        for (const auto& position : positions) {
+            try {
+                sum += constMap.atPosition("layer", position);
+            } catch (const std::out_of_range&) {
+                sum += grid_map::NO_INFORMATION;
+            }
+        }
+        return sum;
+    }, positions.size(), checksum));
+    std::printf("isInside + atPosition       %7.2f ns/query\n", measureNs([&]() {
+        unsigned sum = 0;
+        for (const auto& position : positions) {
+            sum += constMap.isInside(position) ? constMap.atPosition("layer", position) : grid_map::NO_INFORMATION;
+        }
+        return sum;
+    }, positions.size(), checksum));
+    std::printf("LayerAccessor<Checked>      %7.2f ns/query\n", measureNs([&]() {
+        return sumAtPositions<grid_map::bounds::Checked>(map, positions);
+    }, positions.size(), checksum));
+    std::printf("LayerAccessor<Clamped>      %7.2f ns/query\n", measureNs([&]() {
+        return sumAtPositions<grid_map::bounds::Clamped>(map, positions);
+    }, positions.size(), checksum));
+    std::printf("LayerAccessor<Wrapped>      %7.2f ns/query\n", measureNs([&]() {
+        return sumAtPositions<grid_map::bounds::Wrapped>(map, positions);
+    }, positions.size(), checksum));
+
+    // Index access over the whole buffer (all hits).
+    const grid_map::Size& size = map.getSize();
+    const size_t nCells = size.prod();
+    const int repetitions = 20;
+    std::printf("GridMap::at                 %7.2f ns/cell\n", measureNs([&]() {
+        unsigned sum = 0;
+        for (int r = 0; r < repetitions; ++r) {
+            for (int j = 0; j < size(1); ++j) {
+                for (int i = 0; i < size(0); ++i) sum += constMap.at("layer", grid_map::Index(i, j));
+            }
+        }
+        return sum;
+    }, repetitions * nCells, checksum));
+    std::printf("LayerAccessor<Unchecked>    %7.2f ns/cell\n", measureNs([&]() {
+        grid_map::LayerAccessor<grid_map::bounds::Unchecked> accessor(map, "layer");
+        unsigned sum = 0;
+        for (int r = 0; r < repetitions; ++r) {
+            for (int j = 0; j < size(1); ++j) {
+                for (int i = 0; i < size(0); ++i) sum += *accessor.find(grid_map::Index(i, j));
+            }
+        }
+        return sum;
+    }, repetitions * nCells, checksum));
+    std::printf("LayerAccessor<Checked>      %7.2f ns/cell\n", measureNs([&]() {
+        grid_map::LayerAccessor<grid_map::bounds::Checked> accessor(map, "layer");
+        unsigned sum = 0;
+        for (int r = 0; r < repetitions; ++r) {
+            for (int j = 0; j < size(1); ++j) {
+                for (int i = 0; i < size(0); ++i) sum += accessor.valueOr(grid_map::Index(i, j), 0);
+            }
+        }
+        return sum;
+    }, repetitions * nCells, checksum));
+
+    std::printf("(checksum %u)\n", checksum);
+    return 0;
+}
@@ -0,0 +1,113 @@
+#include <grid_map/GridMap.hpp>
+#include <grid_map/GridMapMath.hpp>
+#include <grid_map/iterators/GridMapIterator.hpp>
+#include <grid_map/operators/Inflation.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+// Compares BufferMode::DEFAULT and BufferMode::POWER_OF_TWO on a rolling window
+// workload: the map follows a robot, and after every move the whole buffer is
+// traversed in unwrapped order and a batch of positions is looked up. Times are per
+// map of the requested size, such that the cells added by rounding up the buffer
+// size count against POWER_OF_TWO.
+
+namespace {
+
+typedef std::chrono::high_resolution_clock Clock;
+
+struct Result
+{
+    double iterateUsPerMap;
+    double wrapUsPerMap;
+    double lookupNsPerQuery;
+    unsigned checksum;
+};
+
+Result runRollingWindow(grid_map::BufferMode mode, double length, double resolution, int steps)
+{
+    grid_map::GridMap map({"layer"});
+    map.setBufferMode(mode);
+    map.setGeometry(grid_map::Length(length, length), resolution, grid_map::Position(0.0, 0.0));
+    map.add("layer", grid_map::FREE_SPACE);
+    grid_map::Matrix& data = map.get("layer");
+
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> offset(-0.5 * length, 0.5 * length);
+    std::vector<grid_map::Position> queries(100000);
+
+    double iterateNs = 0.0, wrapNs = 0.0, lookupNs = 0.0;
+    size_t nQueries = 0;
+    unsigned checksum = 0;
+
+    grid_map::Position robot(0.0, 0.0);
+    for (int step = 0; step < steps; ++step) {
+        robot += grid_map::Position(0.37, 0.21);
+        map.move(robot);
+        const grid_map::Size& size = map.getSize();
+        const grid_map::Index& startIndex = map.getStartIndex();
+
+        // Full traversal, converting linear indices to 2d and buffer indices to unwrapped ones.
+        auto start = Clock::now();
+        for (grid_map::GridMapIterator iterator(map); !iterator.isPastEnd(); ++iterator) {
+            const grid_map::Index index(*iterator);
+            const grid_map::Index unwrapped(iterator.getUnwrappedIndex());
+            data(index(0), index(1)) = static_cast<grid_map::DataType>((unwrapped(0) + unwrapped(1)) & 0x7F);
+        }
+        iterateNs += std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+        // Rolling window update: unwrapped row/column indices mapped back into the buffer.
+        start = Clock::now();
+        for (int j = 0; j < size(1); ++j) {
+            for (int i = 0; i < size(0); ++i) {
+                const grid_map::Index index = grid_map::getBufferIndexFromIndex(grid_map::Index(i, j), size, startIndex);
+                checksum += data(index(0), index(1));
+            }
+        }
+        wrapNs += std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+        // Position lookups around the robot.
+        for (auto& query : queries) {
+            query = robot + grid_map::Position(offset(generator), offset(generator));
+        }
+        start = Clock::now();
+        grid_map::Index index;
+        for (const auto& query : queries) {
+            if (map.getIndex(query, index)) checksum += data(index(0), index(1));
+        }
+        lookupNs += std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        nQueries += queries.size();
+    }
+
+    return Result{iterateNs / steps * 1e-3, wrapNs / steps * 1e-3, lookupNs / nQueries, checksum};
+}
+
+void printResult(const char* name, grid_map::BufferMode mode, double length, double resolution, int steps)
+{
+    grid_map::GridMap map;
+    map.setBufferMode(mode);
+    map.setGeometry(grid_map::Length(length, length), resolution);
+    const Result result = runRollingWindow(mode, length, resolution, steps);
+    const double nRequestedCells = std::pow(std::round(length / resolution), 2);
+    std::printf("%-13s buffer %5d x %-5d (%4.0f%% cells)  iterate %9.1f us/map  wrap %9.1f us/map  lookup %6.2f ns/query  (%u)\n",
+                name, map.getSize()(0), map.getSize()(1), 100.0 * map.getSize().prod() / nRequestedCells,
+                result.iterateUsPerMap, result.wrapUsPerMap, result.lookupNsPerQuery, result.checksum);
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    const int steps = argc > 1 ? std::atoi(argv[1]) : 20;
+    const double resolutions[] = {0.05, 0.01};
+    for (double resolution : resolutions) {
+        std::printf("Rolling window 10 m x 10 m, resolution %.2f m, %d steps\n", resolution, steps);
+        printResult("DEFAULT", grid_map::BufferMode::DEFAULT, 10.0, resolution, steps);
+        printResult("POWER_OF_TWO", grid_map::BufferMode::POWER_OF_TWO, 10.0, resolution, steps);
+    }
+    return 0;
+}
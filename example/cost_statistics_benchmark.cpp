@@ -0,0 +1,77 @@
+#include <grid_map/GridMap.hpp>
+#include <grid_map/operators/CostStatistics.hpp>
+#include <grid_map/iterators/GridMapIterator.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+// Compares cost statistics (known cells, range, mean, lethal fraction) and the cost
+// histogram over a layer with GridMapIterator + at(...) and CostStatisticsComputer.
+
+namespace {
+
+typedef std::chrono::high_resolution_clock Clock;
+
+template<typename Function>
+double measureMs(Function function, const int nRepetitions, double& checksum)
+{
+    const auto start = Clock::now();
+    for (int i = 0; i < nRepetitions; ++i) checksum += function();
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count() / nRepetitions;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    const int nRepetitions = argc > 1 ? std::atoi(argv[1]) : 20;
+    grid_map::GridMap map({"costs"});
+    map.setGeometry(grid_map::Length(100.0, 100.0), 0.05, grid_map::Position(0.0, 0.0));
+    map.move(grid_map::Position(1.3, -0.7));
+    srand(1);
+    for (int i = 0; i < map["costs"].size(); ++i) {
+        const int r = rand() % 10;
+        map["costs"](i) = r == 0 ? grid_map::NO_INFORMATION : (r == 1 ? grid_map::LETHAL_OBSTACLE : rand() % 200);
+    }
+    std::printf("%d x %d cells, %d repetitions\n", map.getSize()(0), map.getSize()(1), nRepetitions);
+
+    double checksum = 0.0;
+    std::printf("GridMapIterator statistics   %8.3f ms\n", measureMs([&]() {
+        grid_map::CostStatistics statistics;
+        for (grid_map::GridMapIterator iterator(map); !iterator.isPastEnd(); ++iterator) {
+            const unsigned char cost = map.at("costs", *iterator);
+            if (cost == grid_map::NO_INFORMATION) continue;
+            ++statistics.number_of_known;
+            statistics.sum += cost;
+            statistics.min = std::min(statistics.min, cost);
+            statistics.max = std::max(statistics.max, cost);
+            statistics.number_of_lethal += cost >= grid_map::LETHAL_OBSTACLE;
+        }
+        return statistics.mean() + statistics.lethalFraction();
+    }, nRepetitions, checksum));
+
+    const grid_map::CostStatisticsComputer computer;
+    std::printf("CostStatisticsComputer       %8.3f ms\n", measureMs([&]() {
+        const grid_map::CostStatistics statistics = computer(map["costs"]);
+        return statistics.mean() + statistics.lethalFraction();
+    }, nRepetitions, checksum));
+
+    std::printf("GridMapIterator histogram    %8.3f ms\n", measureMs([&]() {
+        grid_map::CostHistogram histogram;
+        histogram.fill(0);
+        for (grid_map::GridMapIterator iterator(map); !iterator.isPastEnd(); ++iterator) {
+            ++histogram[map.at("costs", *iterator)];
+        }
+        return double(histogram[grid_map::LETHAL_OBSTACLE]);
+    }, nRepetitions, checksum));
+
+    std::printf("CostStatisticsComputer hist. %8.3f ms\n", measureMs([&]() {
+        grid_map::CostHistogram histogram;
+        computer.histogram(map["costs"], histogram);
+        return double(histogram[grid_map::LETHAL_OBSTACLE]);
+    }, nRepetitions, checksum));
+    std::printf("checksum %g\n", checksum);
+    return 0;
+}
@@ -1,12 +1,142 @@
 #include <QApplication>
 #include <QHBoxLayout>
+#include <QTimer>
+#include <grid_map/GridMapMath.hpp>
 #include <grid_map/operators/Inflation.hpp>
 #include <grid_map/Polygon.hpp>
+#include <grid_map/iterators/CircleIterator.hpp>
 #include <grid_map/iterators/PolygonIterator.hpp>
 #include "grid_map/visualization/qt_display.hpp"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+// Usage: gridmap_sandbox [--live [update_rate_hz]]
+//
+// Without arguments shows an inflated polygon. With --live a synthetic robot drives
+// in circles at the center of a rolling map, a writer thread moves the map, adds the
+// obstacles coming into view and stamps the trail of the robot at update_rate_hz
+// (default 200), the viewer follows through a LiveView render thread at 60 Hz. Once
+// per second the rates and the latency from a change to its paint are printed.
+
+namespace {
+
+// pillars every 2m in the world frame, such that moving the map shows a fixed world
+unsigned char worldCost(const grid_map::Position& position)
+{
+    const double x = position.x() - 2.0 * std::floor(position.x() / 2.0);
+    const double y = position.y() - 2.0 * std::floor(position.y() / 2.0);
+    return (x < 0.2 && y < 0.2) ? grid_map::LETHAL_OBSTACLE : grid_map::FREE_SPACE;
+}
+
+void fillRegion(grid_map::GridMap& map, const grid_map::BufferRegion& region)
+{
+    grid_map::Matrix& data = map["layer"];
+    grid_map::Position position;
+    for( int j = 0; j < region.getSize()(1); j++ )
+    {
+        for( int i = 0; i < region.getSize()(0); i++ )
+        {
+            const grid_map::Index index = region.getStartIndex() + grid_map::Index(i, j);
+            map.getPosition(index, position);
+            data(index(0), index(1)) = worldCost(position);
+        }
+    }
+}
+
+int runLiveView(int argc, char *argv[], double update_rate)
+{
+    grid_map::GridMap map({"layer"});
+    map.setGeometry(grid_map::Length(40.0, 40.0), 0.02, grid_map::Position(0.0, 0.0));
+    fillRegion(map, grid_map::BufferRegion(grid_map::Index::Zero(), map.getSize(),
+                                           grid_map::BufferRegion::Quadrant::Undefined));
+    std::mutex map_mutex;
+
+    QApplication app(argc, argv);
+    QGuiApplication::setApplicationDisplayName(ImageViewer::tr("Live View"));
+    QMainWindow win;
+    auto viewer = new ImageViewer();
+    LiveView live_view(viewer, map, "layer", map_mutex, 60.0);
+    win.setCentralWidget(viewer);
+    win.resize(QSize(900, 900));
+
+    // the writer: moves the map with the robot and posts what changed
+    std::atomic<bool> running(true);
+    std::atomic<long> max_step_us(0);
+    std::thread writer([&]() {
+        const auto period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                std::chrono::duration<double>(1.0 / update_rate));
+        const double radius = 0.3;
+        std::vector<grid_map::BufferRegion> dirty_regions, footprint_regions;
+        auto next_step = std::chrono::steady_clock::now();
+        for( double time = 0.0; running; time += 1.0 / update_rate )
+        {
+            const auto step_start = std::chrono::steady_clock::now();
+            const grid_map::Position robot(10.0 * std::cos(0.1 * time), 10.0 * std::sin(0.1 * time));
+            {
+                std::lock_guard<std::mutex> lock(map_mutex);
+                map.move(robot, dirty_regions);
+                for( const auto& region: dirty_regions )
+                {
+                    fillRegion(map, region);
+                }
+                for( grid_map::CircleIterator iterator(map, robot, radius); !iterator.isPastEnd(); ++iterator )
+                {
+                    map.at("layer", *iterator) = grid_map::INSCRIBED_OBSTACLE;
+                }
+                grid_map::Index top_left;
+                map.getIndex(robot + grid_map::Position(radius, radius), top_left);
+                const int n = static_cast<int>(std::ceil(2.0 * radius / map.getResolution())) + 1;
+                if( grid_map::getBufferRegionsForSubmap(footprint_regions, top_left, grid_map::Size(n, n),
+                                                        map.getSize(), map.getStartIndex()) )
+                {
+                    dirty_regions.insert(dirty_regions.end(), footprint_regions.begin(), footprint_regions.end());
+                }
+            }
+            live_view.queue().post(map.getStartIndex(), dirty_regions);
+
+            const long step_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                                     std::chrono::steady_clock::now() - step_start).count();
+            if( step_us > max_step_us ) max_step_us = step_us;
+            next_step += period;
+            std::this_thread::sleep_until(next_step);
+        }
+    });
+
+    QTimer report;
+    size_t last_posts = 0, last_frames = 0;
+    QObject::connect(&report, &QTimer::timeout, [&]() {
+        const NonAntiAliasImage::Latency latency = viewer->imageWidget()->takeLatency();
+        std::printf("%zu posts/s, %zu frames/s, latency post to paint: mean %.1f ms max %.1f ms, writer step max %.2f ms\n",
+                    live_view.posts() - last_posts, live_view.frames() - last_frames,
+                    latency.count > 0 ? latency.sum_ms / latency.count : 0.0, latency.max_ms,
+                    max_step_us.exchange(0) / 1000.0);
+        last_posts = live_view.posts();
+        last_frames = live_view.frames();
+    });
+    report.start(1000);
+
+    win.show();
+    const int result = app.exec();
+    running = false;
+    writer.join();
+    return result;
+}
+
+} // namespace
 
 int main(int argc, char *argv[])
 {
+    if( argc > 1 && std::strcmp(argv[1], "--live") == 0 )
+    {
+        return runLiveView(argc, argv, argc > 2 ? std::atof(argv[2]) : 200.0);
+    }
+
     grid_map::GridMap map({"layer", "inflated"});
     map.setGeometry(grid_map::Length(5.0, 3.0), 0.01, grid_map::Position(0.0, 0.0)); // bufferSize(8, 5)
 
@@ -39,9 +169,9 @@ int main(int argc, char *argv[])
     auto layout = new QHBoxLayout();
 
     auto image1 = new ImageViewer();
-    image1->load( map.get("layer") );
+    image1->load( map, "layer" );
     auto image2 = new ImageViewer();
-    image2->load( map.get("inflated") );
+    image2->load( map, "inflated" );
 
     layout->addWidget(image1);
     layout->addWidget(image2);
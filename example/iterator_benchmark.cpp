@@ -0,0 +1,114 @@
+#include <grid_map/GridMap.hpp>
+#include <grid_map/Polygon.hpp>
+#include <grid_map/iterators/CircleIterator.hpp>
+#include <grid_map/iterators/EllipseIterator.hpp>
+#include <grid_map/iterators/PolygonIterator.hpp>
+#include <grid_map/iterators/SubmapIterator.hpp>
+
+#include <Eigen/Geometry>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// Construction and iteration costs of the shape iterators for robot footprint
+// sized regions (about 0.6 m at 5 cm resolution), as used for collision checks.
+
+namespace {
+
+typedef std::chrono::high_resolution_clock Clock;
+
+template<typename Function>
+double measureNs(const int nRepetitions, Function function, unsigned& checksum)
+{
+    const auto start = Clock::now();
+    for (int i = 0; i < nRepetitions; ++i) checksum += function(i);
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / nRepetitions;
+}
+
+template<typename Iterator>
+unsigned sumOfCells(const grid_map::Matrix& data, Iterator& iterator)
+{
+    unsigned sum = 0;
+    for (; !iterator.isPastEnd(); ++iterator) sum += data((*iterator)(0), (*iterator)(1));
+    return sum;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    const int nRepetitions = argc > 1 ? std::atoi(argv[1]) : 100000;
+    grid_map::GridMap map({"layer"});
+    map.setGeometry(grid_map::Length(20.0, 20.0), 0.05, grid_map::Position(0.0, 0.0));
+    map.get("layer").setRandom();
+    map.move(grid_map::Position(1.3, -0.7)); // Exercise the circular buffer.
+    const grid_map::Matrix& data = map["layer"];
+
+    std::vector<grid_map::Position> centers;
+    for (int i = 0; i < 1024; ++i) {
+        centers.push_back(map.getPosition() + grid_map::Position(std::sin(0.1 * i), std::cos(0.13 * i)) * 5.0);
+    }
+    grid_map::Polygon footprint({grid_map::Position(0.35, 0.25), grid_map::Position(0.35, -0.25),
+                                 grid_map::Position(-0.3, -0.25), grid_map::Position(-0.3, 0.25)});
+    std::vector<grid_map::Polygon> footprints;
+    for (size_t i = 0; i < centers.size(); ++i) {
+        grid_map::Polygon polygon;
+        const double angle = 0.37 * i;
+        for (const auto& vertex : footprint.getVertices()) {
+            polygon.addVertex(centers[i] + Eigen::Rotation2Dd(angle) * vertex);
+        }
+        footprints.push_back(polygon);
+    }
+    const auto center = [&](const int i) { return centers[i % centers.size()]; };
+    std::printf("%d repetitions, ns per iterator\n", nRepetitions);
+    std::printf("%-10s %12s %12s\n", "", "construct", "iterate");
+
+    unsigned checksum = 0;
+    {
+        const double construct = measureNs(nRepetitions, [&](const int i) {
+            grid_map::CircleIterator iterator(map, center(i), 0.3);
+            return (*iterator)(0);
+        }, checksum);
+        const double iterate = measureNs(nRepetitions, [&](const int i) {
+            grid_map::CircleIterator iterator(map, center(i), 0.3);
+            return sumOfCells(data, iterator);
+        }, checksum);
+        std::printf("%-10s %12.1f %12.1f\n", "circle", construct, iterate);
+    }
+    {
+        const double construct = measureNs(nRepetitions, [&](const int i) {
+            grid_map::EllipseIterator iterator(map, center(i), grid_map::Length(0.7, 0.5), 0.37 * i);
+            return (*iterator)(0);
+        }, checksum);
+        const double iterate = measureNs(nRepetitions, [&](const int i) {
+            grid_map::EllipseIterator iterator(map, center(i), grid_map::Length(0.7, 0.5), 0.37 * i);
+            return sumOfCells(data, iterator);
+        }, checksum);
+        std::printf("%-10s %12.1f %12.1f\n", "ellipse", construct, iterate);
+    }
+    {
+        const double construct = measureNs(nRepetitions, [&](const int i) {
+            grid_map::PolygonIterator iterator(map, footprints[i % footprints.size()]);
+            return (*iterator)(0);
+        }, checksum);
+        const double iterate = measureNs(nRepetitions, [&](const int i) {
+            grid_map::PolygonIterator iterator(map, footprints[i % footprints.size()]);
+            return sumOfCells(data, iterator);
+        }, checksum);
+        std::printf("%-10s %12.1f %12.1f\n", "polygon", construct, iterate);
+    }
+    {
+        const double iterate = measureNs(nRepetitions, [&](const int i) {
+            grid_map::Index startIndex;
+            map.getIndex(center(i) + grid_map::Position(0.3, 0.3), startIndex);
+            grid_map::SubmapIterator iterator(map, startIndex, grid_map::Size(12, 12));
+            return sumOfCells(data, iterator);
+        }, checksum);
+        std::printf("%-10s %12s %12.1f\n", "submap", "", iterate);
+    }
+    std::printf("checksum %u\n", checksum);
+    return 0;
+}
@@ -0,0 +1,81 @@
+#include <grid_map/GridMap.hpp>
+#include <grid_map/operators/Inflation.hpp>
+#include <grid_map/visualization/LayerImageRenderer.hpp>
+#include <grid_map/visualization/LayerPyramid.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// Compares rendering a whole large layer (what the viewer did for every paint) with
+// rendering only the tiles of a 1920 x 1080 viewport from the max-pooled pyramid,
+// with an empty tile cache, and measures building and updating the pyramid.
+
+namespace {
+
+typedef std::chrono::high_resolution_clock Clock;
+
+template<typename Function>
+double measureMs(Function function, const int nRepetitions)
+{
+    const auto start = Clock::now();
+    for (int i = 0; i < nRepetitions; ++i) function();
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count() / nRepetitions;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    const int nRepetitions = argc > 1 ? std::atoi(argv[1]) : 5;
+    grid_map::GridMap map({"costs"});
+    map.setGeometry(grid_map::Length(400.0, 400.0), 0.05, grid_map::Position(0.0, 0.0));
+    map.move(grid_map::Position(1.3, -0.7));
+    srand(1);
+    for (int i = 0; i < map["costs"].size(); ++i) {
+        map["costs"](i) = rand() % 100 == 0 ? grid_map::LETHAL_OBSTACLE : grid_map::FREE_SPACE;
+    }
+    const grid_map::Size size = map.getSize();
+    std::printf("%d x %d cells, %d repetitions\n", size(0), size(1), nRepetitions);
+
+    const grid_map::LayerImageRenderer renderer;
+    std::vector<uint32_t> image(size_t(size(0)) * size(1));
+    std::printf("render whole layer          %9.3f ms\n", measureMs([&]() {
+        renderer.render(map["costs"], map.getStartIndex(), image.data(), size(1) * sizeof(uint32_t));
+    }, nRepetitions));
+
+    grid_map::LayerPyramid pyramid;
+    const double buildMs = measureMs([&]() {
+        pyramid.setLayer(map["costs"], map.getStartIndex());
+    }, nRepetitions);
+    std::printf("build pyramid               %9.3f ms (%zu levels)\n", buildMs, pyramid.getNumberOfLevels());
+
+    std::vector<grid_map::BufferRegion> newRegions;
+    map.move(grid_map::Position(1.8, -0.2), newRegions);
+    std::printf("update pyramid after move   %9.3f ms\n", measureMs([&]() {
+        for (const auto& region : newRegions) pyramid.update(map["costs"], map.getStartIndex(), region);
+    }, nRepetitions));
+
+    // Tiles of 256 x 256 cells of the level covering the viewport at the top left.
+    const int tileSize = 256;
+    std::vector<uint32_t> tile(tileSize * tileSize);
+    for (const double pixelsPerCell : {4.0, 1.0, 0.3, 0.1}) {
+        const size_t level = pyramid.getLevelForScale(pixelsPerCell);
+        const grid_map::Size levelSize = pyramid.getSize(level);
+        const double levelPixelsPerCell = pixelsPerCell * (1 << level);
+        const int nRows = std::min(int(1080 / levelPixelsPerCell) / tileSize + 1, (levelSize(0) - 1) / tileSize + 1);
+        const int nColumns = std::min(int(1920 / levelPixelsPerCell) / tileSize + 1, (levelSize(1) - 1) / tileSize + 1);
+        std::printf("viewport at %4.1f px/cell    %9.3f ms (level %zu, %d tiles)\n", pixelsPerCell, measureMs([&]() {
+            for (int row = 0; row < nRows; ++row) {
+                for (int column = 0; column < nColumns; ++column) {
+                    const grid_map::Index start(row * tileSize, column * tileSize);
+                    renderer.renderTile(pyramid.getLevel(level), pyramid.getBufferStartIndex(level), start,
+                                        grid_map::Size(tileSize, tileSize), tile.data(), tileSize * sizeof(uint32_t));
+                }
+            }
+        }, nRepetitions), level, nRows * nColumns);
+    }
+    return 0;
+}
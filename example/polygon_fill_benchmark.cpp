@@ -0,0 +1,79 @@
+#include <grid_map/GridMap.hpp>
+#include <grid_map/operators/FillPolygons.hpp>
+#include <grid_map/iterators/PolygonIterator.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// Compares filling keep-out zones into a static layer with one PolygonIterator per
+// zone and with the FillPolygons operator.
+
+namespace {
+
+typedef std::chrono::high_resolution_clock Clock;
+
+template<typename Function>
+double measureMs(Function function)
+{
+    const auto start = Clock::now();
+    function();
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+double getRandom(const double min, const double max)
+{
+    return min + (max - min) * rand() / RAND_MAX;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    const int nPolygons = argc > 1 ? std::atoi(argv[1]) : 5000;
+    grid_map::GridMap map({"zones"});
+    map.setGeometry(grid_map::Length(200.0, 200.0), 0.05, grid_map::Position(0.0, 0.0));
+    map.move(grid_map::Position(3.3, -1.7)); // Exercise the circular buffer.
+    srand(1);
+
+    // Zones of 1 to 10 m, some of them crossing the map border.
+    std::vector<grid_map::Polygon> polygons;
+    std::vector<unsigned char> values;
+    for (int i = 0; i < nPolygons; ++i) {
+        const grid_map::Position center(getRandom(-105.0, 105.0), getRandom(-105.0, 105.0));
+        const double radius = getRandom(0.5, 5.0);
+        grid_map::Polygon polygon;
+        for (int k = 0; k < 8; ++k) {
+            const double angle = M_PI * k / 4.0 + getRandom(0.0, 0.5);
+            polygon.addVertex(center + radius * grid_map::Vector(std::cos(angle), std::sin(angle)));
+        }
+        polygons.push_back(polygon);
+        values.push_back(rand() % 253);
+    }
+    std::printf("%d polygons on %d x %d cells\n", nPolygons, map.getSize()(0), map.getSize()(1));
+
+    map["zones"].setZero();
+    std::printf("PolygonIterator + at         %8.2f ms\n", measureMs([&]() {
+        for (size_t i = 0; i < polygons.size(); ++i) {
+            for (grid_map::PolygonIterator iterator(map, polygons[i]); !iterator.isPastEnd(); ++iterator) {
+                unsigned char& value = map.at("zones", *iterator);
+                value = std::max(value, values[i]);
+            }
+        }
+    }));
+    const grid_map::Matrix expected = map["zones"];
+
+    for (const unsigned int nThreads : {1u, 0u}) {
+        grid_map::ThreadPool threadPool(nThreads);
+        map["zones"].setZero();
+        const double time = measureMs([&]() {
+            grid_map::FillPolygons(grid_map::PolygonFillMode::MAXIMUM)("zones", polygons, values, map, threadPool);
+        });
+        std::printf("FillPolygons %2u threads      %8.2f ms%s\n", threadPool.getNumberOfThreads(), time,
+                    map["zones"] == expected ? "" : " (mismatch)");
+    }
+    return 0;
+}
@@ -0,0 +1,96 @@
+#include <grid_map/PolygonIndex.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// Compares a linear scan over a set of zones with PolygonIndex for point and box
+// (map cell) queries, as well as loading, removing and reinserting the zones.
+
+namespace {
+
+typedef std::chrono::high_resolution_clock Clock;
+
+template<typename Function>
+double measureMs(Function function, size_t& checksum)
+{
+    const auto start = Clock::now();
+    checksum += function();
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+double getRandom(const double min, const double max)
+{
+    return min + (max - min) * rand() / RAND_MAX;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    const int nPolygons = argc > 1 ? std::atoi(argv[1]) : 10000;
+    const int nQueries = argc > 2 ? std::atoi(argv[2]) : 10000;
+    const double resolution = 0.05;
+    srand(1);
+
+    // Zones of 0.2 to 2 m in a 200 x 200 m area.
+    std::vector<grid_map::Polygon> polygons;
+    for (int i = 0; i < nPolygons; ++i) {
+        const grid_map::Position center(getRandom(-100.0, 100.0), getRandom(-100.0, 100.0));
+        const double radius = getRandom(0.1, 1.0);
+        grid_map::Polygon polygon;
+        for (int k = 0; k < 6; ++k) {
+            const double angle = M_PI * k / 3.0 + getRandom(0.0, 0.5);
+            polygon.addVertex(center + radius * grid_map::Vector(std::cos(angle), std::sin(angle)));
+        }
+        polygons.push_back(polygon);
+    }
+    std::vector<grid_map::Position> points;
+    for (int i = 0; i < nQueries; ++i) points.emplace_back(getRandom(-100.0, 100.0), getRandom(-100.0, 100.0));
+    const grid_map::Vector halfCell = grid_map::Vector::Constant(0.5 * resolution);
+    std::printf("%d polygons, %d queries\n", nPolygons, nQueries);
+
+    size_t checksum = 0;
+    std::printf("linear scan, points          %8.2f ms\n", measureMs([&]() {
+        size_t nHits = 0;
+        for (const auto& point : points) {
+            for (const auto& polygon : polygons) nHits += polygon.isInside(point);
+        }
+        return nHits;
+    }, checksum));
+
+    grid_map::PolygonIndex index(20.0 * resolution);
+    std::printf("bulk load                    %8.2f ms\n", measureMs([&]() {
+        index.insert(polygons);
+        return index.size();
+    }, checksum));
+
+    std::vector<grid_map::PolygonIndex::Id> ids;
+    std::printf("index, points                %8.2f ms\n", measureMs([&]() {
+        size_t nHits = 0;
+        for (const auto& point : points) {
+            index.getContaining(point, ids);
+            nHits += ids.size();
+        }
+        return nHits;
+    }, checksum));
+
+    std::printf("index, cells                 %8.2f ms\n", measureMs([&]() {
+        size_t nHits = 0;
+        for (const auto& point : points) {
+            index.getIntersecting(point - halfCell, point + halfCell, ids);
+            nHits += ids.size();
+        }
+        return nHits;
+    }, checksum));
+
+    std::printf("remove and reinsert 10%%      %8.2f ms\n", measureMs([&]() {
+        for (int i = 0; i < nPolygons; i += 10) index.remove(i);
+        for (int i = 0; i < nPolygons; i += 10) index.insert(polygons[i]);
+        return index.size();
+    }, checksum));
+    std::printf("checksum %zu\n", checksum);
+    return 0;
+}
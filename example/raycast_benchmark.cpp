@@ -0,0 +1,81 @@
+#include <grid_map/GridMap.hpp>
+#include <grid_map/RayCaster.hpp>
+#include <grid_map/operators/Inflation.hpp>
+#include <grid_map/iterators/LineIterator.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// Compares LineIterator + GridMap::at(...) with the batched RayCaster for a laser
+// like workload: rays of 10 m from the map center, maximum cost per ray.
+
+namespace {
+
+typedef std::chrono::high_resolution_clock Clock;
+
+template<typename Function>
+double measureMs(Function function, unsigned& checksum)
+{
+    const auto start = Clock::now();
+    checksum += function();
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+unsigned sumOf(const std::vector<grid_map::DataType>& values)
+{
+    unsigned sum = 0;
+    for (const auto value : values) sum += value;
+    return sum;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    const int nRays = argc > 1 ? std::atoi(argv[1]) : 100000;
+    grid_map::GridMap map({"layer"});
+    map.setGeometry(grid_map::Length(20.0, 20.0), 0.05, grid_map::Position(0.0, 0.0));
+    map.add("layer", grid_map::FREE_SPACE);
+    map.get("layer").setRandom();
+    map.move(grid_map::Position(1.3, -0.7)); // Exercise the circular buffer.
+
+    const grid_map::Position origin = map.getPosition();
+    std::vector<grid_map::Position> endpoints;
+    for (int k = 0; k < nRays; ++k) {
+        const double angle = 2.0 * M_PI * k / nRays;
+        endpoints.push_back(origin + 10.0 * grid_map::Vector(std::cos(angle), std::sin(angle)));
+    }
+    std::printf("%d rays of 10 m at 5 cm resolution\n", nRays);
+
+    unsigned checksum = 0;
+    std::printf("LineIterator + at            %8.2f ms\n", measureMs([&]() {
+        std::vector<grid_map::DataType> maxValues(endpoints.size(), 0);
+        for (size_t i = 0; i < endpoints.size(); ++i) {
+            for (grid_map::LineIterator iterator(map, origin, endpoints[i]); !iterator.isPastEnd(); ++iterator) {
+                maxValues[i] = std::max(maxValues[i], map.at("layer", *iterator));
+            }
+        }
+        return sumOf(maxValues);
+    }, checksum));
+
+    for (const auto traversal : {grid_map::RayTraversal::BRESENHAM, grid_map::RayTraversal::EXACT}) {
+        for (const unsigned int nThreads : {1u, 0u}) {
+            grid_map::RayCaster rayCaster(map, traversal);
+            rayCaster.setNumberOfThreads(nThreads);
+            const double time = measureMs([&]() {
+                std::vector<grid_map::DataType> maxValues;
+                rayCaster.getMaxValues(map["layer"], origin, endpoints, maxValues);
+                return sumOf(maxValues);
+            }, checksum);
+            std::printf("RayCaster %-9s %2u threads %8.2f ms\n",
+                        traversal == grid_map::RayTraversal::EXACT ? "exact" : "bresenham",
+                        grid_map::resolveNumberOfThreads(nThreads), time);
+        }
+    }
+    std::printf("checksum %u\n", checksum);
+    return 0;
+}
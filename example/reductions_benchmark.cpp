@@ -0,0 +1,53 @@
+#include <grid_map/GridMap.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+// Measures the reductions over finite values of the Eigen plugins on float layers
+// (with some NaN) and on uint8 cost layers, against the plain Eigen reductions.
+
+namespace {
+
+typedef std::chrono::high_resolution_clock Clock;
+
+template<typename Function>
+double measureMs(Function function, const int nRepetitions, double& checksum)
+{
+    const auto start = Clock::now();
+    for (int i = 0; i < nRepetitions; ++i) checksum += function();
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count() / nRepetitions;
+}
+
+template<typename Matrix>
+void run(const char* name, const Matrix& matrix, const int nRepetitions)
+{
+    double checksum = 0.0;
+    std::printf("%s\n", name);
+    std::printf("  sum                  %8.3f ms\n", measureMs([&]() { return double(matrix.sum()); }, nRepetitions, checksum));
+    std::printf("  sumOfFinites         %8.3f ms\n", measureMs([&]() { return double(matrix.sumOfFinites()); }, nRepetitions, checksum));
+    std::printf("  meanOfFinites        %8.3f ms\n", measureMs([&]() { return double(matrix.meanOfFinites()); }, nRepetitions, checksum));
+    std::printf("  minCoeffOfFinites    %8.3f ms\n", measureMs([&]() { return double(matrix.minCoeffOfFinites()); }, nRepetitions, checksum));
+    std::printf("  maxCoeffOfFinites    %8.3f ms\n", measureMs([&]() { return double(matrix.maxCoeffOfFinites()); }, nRepetitions, checksum));
+    std::printf("  checksum %g\n", checksum);
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    const int size = argc > 1 ? std::atoi(argv[1]) : 2000;
+    const int nRepetitions = argc > 2 ? std::atoi(argv[2]) : 20;
+    std::printf("%d x %d cells, %d repetitions\n", size, size, nRepetitions);
+
+    Eigen::MatrixXf floats(Eigen::MatrixXf::Random(size, size));
+    for (int i = 0; i < floats.size(); i += 97) floats(i) = NAN;
+    run("float", floats, nRepetitions);
+    run("double", Eigen::MatrixXd(floats.cast<double>()), nRepetitions);
+
+    grid_map::Matrix costs(size, size);
+    for (int i = 0; i < costs.size(); ++i) costs(i) = rand() % 256;
+    run("uint8", costs, nRepetitions);
+    return 0;
+}
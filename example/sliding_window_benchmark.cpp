@@ -0,0 +1,50 @@
+#include <grid_map/GridMap.hpp>
+#include <grid_map/SlidingWindowFilter.hpp>
+#include <grid_map/iterators/SlidingWindowIterator.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+// Compares the window copies of SlidingWindowIterator::getData() with the
+// incremental SlidingWindowFilter for the maximum over a square window.
+
+namespace {
+
+typedef std::chrono::high_resolution_clock Clock;
+
+template<typename Function>
+double measureMs(Function function)
+{
+    const auto start = Clock::now();
+    function();
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    grid_map::GridMap map({"layer"});
+    map.setGeometry(grid_map::Length(20.0, 20.0), 0.05, grid_map::Position(0.0, 0.0));
+    map.get("layer").setRandom();
+    map.add("iterator", 0);
+    std::printf("%d x %d cells\n", map.getSize()(0), map.getSize()(1));
+
+    for (const size_t windowSize : {3, 9, 21}) {
+        const double iteratorTime = measureMs([&]() {
+            grid_map::Matrix& result = map["iterator"];
+            for (grid_map::SlidingWindowIterator iterator(map, "layer", grid_map::SlidingWindowIterator::EdgeHandling::CROP, windowSize);
+                 !iterator.isPastEnd(); ++iterator) {
+                result((*iterator)(0), (*iterator)(1)) = iterator.getData().maxCoeff();
+            }
+        });
+        grid_map::SlidingWindowFilter filter(windowSize);
+        const double filterTime = measureMs([&]() {
+            filter.filter(map, "layer", "filter", grid_map::SlidingWindowFilter::Statistic::MAX);
+        });
+        std::printf("window %2zu: iterator %8.2f ms, filter %6.2f ms, %s\n", windowSize, iteratorTime, filterTime,
+                    (map["iterator"].array() == map["filter"].array()).all() ? "equal" : "DIFFERENT");
+    }
+    return 0;
+}
@@ -0,0 +1,105 @@
+#include <grid_map/GridMap.hpp>
+#include <grid_map/Polygon.hpp>
+#include <grid_map/iterators/PolygonIterator.hpp>
+#include <grid_map/operators/TrajectoryEvaluator.hpp>
+
+#include <Eigen/Geometry>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// DWA-style local planner workload: every cycle scores a window of sampled
+// (velocity, yaw rate) commands, each rolled out as a trajectory of footprint poses
+// on a cost map with scattered obstacles.
+
+namespace {
+
+typedef std::chrono::high_resolution_clock Clock;
+
+std::vector<Eigen::Matrix3Xd> getRollouts(const Eigen::Vector3d& start, const int nVelocities, const int nYawRates,
+                                          const int nPoses, const double timeStep)
+{
+    std::vector<Eigen::Matrix3Xd> trajectories;
+    for (int v = 0; v < nVelocities; ++v) {
+        for (int w = 0; w < nYawRates; ++w) {
+            const double velocity = 0.1 + 0.9 * v / std::max(nVelocities - 1, 1);
+            const double yawRate = -1.0 + 2.0 * w / std::max(nYawRates - 1, 1);
+            Eigen::Matrix3Xd poses(3, nPoses);
+            Eigen::Vector3d pose = start;
+            for (int i = 0; i < nPoses; ++i) {
+                poses.col(i) = pose;
+                pose += timeStep * Eigen::Vector3d(velocity * std::cos(pose.z()), velocity * std::sin(pose.z()), yawRate);
+            }
+            trajectories.push_back(poses);
+        }
+    }
+    return trajectories;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    const int nCycles = argc > 1 ? std::atoi(argv[1]) : 20;
+    grid_map::GridMap map({"costs"});
+    map.setGeometry(grid_map::Length(10.0, 10.0), 0.05, grid_map::Position(0.0, 0.0));
+    map.move(grid_map::Position(0.8, -0.35)); // Exercise the circular buffer.
+    grid_map::Matrix& costs = map["costs"];
+    srand(1);
+    for (int i = 0; i < costs.size(); ++i) costs(i) = rand() % 100;
+    for (int i = 0; i < 300; ++i) {
+        const grid_map::Position offset(9.0 * rand() / RAND_MAX - 4.5, 9.0 * rand() / RAND_MAX - 4.5);
+        if (offset.norm() > 1.0) map.atPosition("costs", map.getPosition() + offset) = 254;
+    }
+
+    const grid_map::Polygon footprint({grid_map::Position(0.35, 0.25), grid_map::Position(0.35, -0.25),
+                                       grid_map::Position(-0.3, -0.25), grid_map::Position(-0.3, 0.25)});
+    const std::vector<Eigen::Matrix3Xd> trajectories = getRollouts(
+        Eigen::Vector3d(map.getPosition().x(), map.getPosition().y(), 0.3), 20, 25, 30, 0.1);
+    std::printf("%d cycles of %zu trajectories with %d poses, ms per cycle\n",
+                nCycles, trajectories.size(), static_cast<int>(trajectories.front().cols()));
+
+    // Baseline: transformed polygon and polygon iterator per pose, stopping at a collision.
+    unsigned long checksum = 0;
+    auto start = Clock::now();
+    for (int cycle = 0; cycle < nCycles; ++cycle) {
+        for (const auto& trajectory : trajectories) {
+            for (int i = 0; i < trajectory.cols(); ++i) {
+                grid_map::Polygon polygon;
+                const Eigen::Rotation2Dd rotation(trajectory(2, i));
+                for (const auto& vertex : footprint.getVertices()) {
+                    polygon.addVertex(trajectory.col(i).head<2>() + rotation * vertex);
+                }
+                unsigned char cost = 0;
+                for (grid_map::PolygonIterator iterator(map, polygon); !iterator.isPastEnd(); ++iterator) {
+                    cost = std::max(cost, costs((*iterator)(0), (*iterator)(1)));
+                }
+                checksum += cost;
+                if (cost >= 254) break;
+            }
+        }
+    }
+    const double iterator = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / nCycles;
+
+    grid_map::TrajectoryEvaluator evaluator(footprint);
+    std::vector<grid_map::TrajectoryCost> results;
+    evaluator("costs", trajectories, map, results); // Build the footprint tables.
+    start = Clock::now();
+    for (int cycle = 0; cycle < nCycles; ++cycle) {
+        evaluator("costs", trajectories, map, results);
+        for (const auto& result : results) checksum += result.sum_cost;
+    }
+    const double evaluate = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / nCycles;
+
+    int nCollisions = 0;
+    for (const auto& result : results) nCollisions += result.first_collision >= 0;
+    std::printf("%-22s %10.2f\n", "polygon iterator", iterator);
+    std::printf("%-22s %10.2f (%u threads)\n", "trajectory evaluator", evaluate,
+                grid_map::ThreadPool::getGlobalPool().getNumberOfThreads());
+    std::printf("%d of %zu trajectories in collision (checksum %lu)\n", nCollisions, results.size(), checksum);
+    return 0;
+}
@@ -0,0 +1,250 @@
+/*
+ * GridIndexer.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include "grid_map/TypeDefs.hpp"
+
+#include <Eigen/Core>
+
+namespace grid_map {
+
+/*!
+ * Conversion between positions in the map frame and (buffer) indices of a grid map.
+ * All geometry dependent terms (vector to the data structure origin, position of the
+ * first cell, circular buffer offsets) are computed once at construction, such that the
+ * conversions reduce to a few additions/multiplications per coordinate.
+ *
+ * The grid map keeps an indexer in sync with its geometry, see `GridMap::getIndexer()`.
+ */
+class GridIndexer
+{
+ public:
+
+  /*!
+   * Default constructor (empty geometry).
+   */
+  GridIndexer();
+
+  /*!
+   * Constructor.
+   * @param mapLength the lengths in x and y direction.
+   * @param mapPosition the position of the map.
+   * @param resolution the resolution of the map.
+   * @param bufferSize the size of the buffer.
+   * @param bufferStartIndex the index of the starting point of the circular buffer.
+   */
+  GridIndexer(const Length& mapLength, const Position& mapPosition, const double resolution,
+              const Size& bufferSize, const Index& bufferStartIndex = Index::Zero());
+
+  /*!
+   * Gets the index of the cell which contains a position in the map frame.
+   * Same as `getIndexFromPosition(...)` of `GridMapMath.hpp`.
+   * @param[out] index of the cell.
+   * @param[in] position the position in the map frame.
+   * @return true if successful, false if position outside of map.
+   */
+  inline bool getIndexFromPosition(Index& index, const Position& position) const;
+
+  /*!
+   * Gets the position of a cell specified by its index in the map frame.
+   * Same as `getPositionFromIndex(...)` of `GridMapMath.hpp`.
+   * @param[out] position the position of the center of the cell in the map frame.
+   * @param[in] index of the cell.
+   * @return true if successful, false if index not within range of buffer.
+   */
+  inline bool getPositionFromIndex(Position& position, const Index& index) const;
+
+  /*!
+   * Checks if position is within the map boundaries.
+   * @param position the position to be checked.
+   * @return true if position is within map, false otherwise.
+   */
+  inline bool isInside(const Position& position) const;
+
+  /*!
+   * Retrieve the index of the buffer from an unwrapped index.
+   * @param index the unwrapped index.
+   * @return the buffer index.
+   */
+  inline Index getBufferIndexFromIndex(const Index& index) const;
+
+  /*!
+   * Retrieve the index as unwrapped index, i.e., as the corresponding index of a
+   * grid map with no circular buffer offset.
+   * @param bufferIndex the index in the circular buffer.
+   * @return the unwrapped index.
+   */
+  inline Index getIndexFromBufferIndex(const Index& bufferIndex) const;
+
+  /*!
+   * Wraps an arbitrary index into the range of the buffer (by bit masks if both
+   * buffer dimensions are powers of two).
+   * @param index the index.
+   * @return the index wrapped into [0, size).
+   */
+  inline Index wrapIndex(const Index& index) const;
+
+  /*!
+   * Computes the continuous (unwrapped) index coordinates of a position, see
+   * `getIndexCoordinatesFromPositions(...)`. Also defined outside of the map.
+   * @param position the position in the map frame.
+   * @return the continuous index coordinates.
+   */
+  inline Eigen::Array2d getIndexCoordinatesFromPosition(const Position& position) const;
+
+  /*!
+   * Computes the continuous (unwrapped) index coordinates of positions, i.e. the
+   * distance to the data structure origin in cells along the buffer axes. The cell
+   * with unwrapped index (i, j) covers the coordinates [i, i+1) x [j, j+1).
+   * @param[in] positions the positions in the map frame (one position per column).
+   * @param[out] coordinates the continuous index coordinates.
+   */
+  void getIndexCoordinatesFromPositions(const Eigen::Ref<const Eigen::Matrix2Xd>& positions,
+                                        Eigen::Array2Xd& coordinates) const;
+
+  /*!
+   * Batch version of `getIndexFromPosition(...)`. Indices of positions outside of the
+   * map are bounded to the closest cell, such that all returned indices can safely be
+   * used to access the buffer.
+   * @param[in] positions the positions in the map frame (one position per column).
+   * @param[out] indices the buffer indices of the cells.
+   * @param[out] isValid true if the position is inside the map, false otherwise.
+   * @return the number of positions inside the map.
+   */
+  size_t getIndicesFromPositions(const Eigen::Ref<const Eigen::Matrix2Xd>& positions,
+                                 Eigen::Array2Xi& indices,
+                                 Eigen::Array<bool, Eigen::Dynamic, 1>& isValid) const;
+
+  /*!
+   * Batch version of `getPositionFromIndex(...)`. The indices have to be within the
+   * range of the buffer.
+   * @param[in] indices the buffer indices of the cells.
+   * @param[out] positions the positions of the cell centers (one position per column).
+   */
+  void getPositionsFromIndices(const Eigen::Ref<const Eigen::Array2Xi>& indices,
+                               Eigen::Matrix2Xd& positions) const;
+
+  /*!
+   * Batch version of `getBufferIndexFromIndex(...)` for unwrapped indices that are
+   * within the range of the buffer.
+   * @param[in] indices the unwrapped indices.
+   * @param[out] bufferIndices the corresponding buffer indices.
+   */
+  void getBufferIndicesFromIndices(const Eigen::Ref<const Eigen::Array2Xi>& indices,
+                                   Eigen::Array2Xi& bufferIndices) const;
+
+  const Length& getLength() const { return length_; }
+  const Position& getPosition() const { return position_; }
+  double getResolution() const { return resolution_; }
+  const Size& getSize() const { return size_; }
+  const Index& getStartIndex() const { return startIndex_; }
+  const Position& getFirstCellPosition() const { return firstCellPosition_; }
+
+ private:
+
+  /*!
+   * Wraps a single coordinate of an index into the range [0, size).
+   * Cheap for indices that are off by at most one buffer size.
+   */
+  static inline int wrap(int index, const int size);
+
+
+  //! Side length of the map in x- and y-direction [m].
+  Length length_;
+
+  //! Map position in the grid map frame [m].
+  Position position_;
+
+  //! Map resolution in xy plane [m/cell].
+  double resolution_;
+
+  //! Size of the buffer.
+  Size size_;
+
+  //! Start index of the circular buffer.
+  Index startIndex_;
+
+  //! True if the buffer start index is (0, 0).
+  bool isDefaultStartIndex_;
+
+  //! True if both buffer dimensions are powers of two.
+  bool isPowerOfTwo_;
+
+  //! Bit masks for wrapping (size - 1), only valid if `isPowerOfTwo_`.
+  Index wrapMask_;
+
+  //! Vector from the center of the map to the data structure origin.
+  Vector vectorToOrigin_;
+
+  //! Position of the center of the first cell (unwrapped index (0, 0)).
+  Position firstCellPosition_;
+
+ public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+inline int GridIndexer::wrap(int index, const int size)
+{
+  if (index >= size) {
+    index -= size;
+    if (index >= size) index %= size;
+  } else if (index < 0) {
+    index += size;
+    if (index < 0) index += ((-index / size) + 1) * size;
+    index %= size;
+  }
+  return index;
+}
+
+inline Index GridIndexer::wrapIndex(const Index& index) const
+{
+  if (isPowerOfTwo_) return Index(index(0) & wrapMask_(0), index(1) & wrapMask_(1));
+  return Index(wrap(index(0), size_(0)), wrap(index(1), size_(1)));
+}
+
+inline Eigen::Array2d GridIndexer::getIndexCoordinatesFromPosition(const Position& position) const
+{
+  return -((position - vectorToOrigin_ - position_) / resolution_).array();
+}
+
+inline bool GridIndexer::getIndexFromPosition(Index& index, const Position& position) const
+{
+  // The index axes point in the negative x/y-direction of the map frame.
+  const Vector indexVector = (position - vectorToOrigin_ - position_) / resolution_;
+  index = getBufferIndexFromIndex(Index(-static_cast<int>(indexVector.x()), -static_cast<int>(indexVector.y())));
+  return isInside(position);
+}
+
+inline bool GridIndexer::getPositionFromIndex(Position& position, const Index& index) const
+{
+  if (index(0) < 0 || index(1) < 0 || index(0) >= size_(0) || index(1) >= size_(1)) return false;
+  const Index unwrappedIndex = getIndexFromBufferIndex(index);
+  position.x() = firstCellPosition_.x() - resolution_ * unwrappedIndex(0);
+  position.y() = firstCellPosition_.y() - resolution_ * unwrappedIndex(1);
+  return true;
+}
+
+inline bool GridIndexer::isInside(const Position& position) const
+{
+  const Vector distance = -(position - position_ - vectorToOrigin_);
+  return distance.x() >= 0.0 && distance.y() >= 0.0
+      && distance.x() < length_(0) && distance.y() < length_(1);
+}
+
+inline Index GridIndexer::getBufferIndexFromIndex(const Index& index) const
+{
+  if (isDefaultStartIndex_) return index;
+  return wrapIndex(index + startIndex_);
+}
+
+inline Index GridIndexer::getIndexFromBufferIndex(const Index& bufferIndex) const
+{
+  if (isDefaultStartIndex_) return bufferIndex;
+  return wrapIndex(bufferIndex - startIndex_);
+}
+
+} /* namespace grid_map */
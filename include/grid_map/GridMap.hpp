@@ -11,6 +11,7 @@
 #include "grid_map/TypeDefs.hpp"
 #include "grid_map/SubmapGeometry.hpp"
 #include "grid_map/BufferRegion.hpp"
+#include "grid_map/GridIndexer.hpp"
 
 // STL
 #include <vector>
@@ -22,6 +23,7 @@
 namespace grid_map {
 
 class SubmapGeometry;
+class Polygon;
 
 /*!
  * Grid map managing multiple overlaying maps holding float values.
@@ -82,6 +84,23 @@ class GridMap
    */
   void setGeometry(const SubmapGeometry& geometry);
 
+  /*!
+   * Set the buffer mode used by subsequent calls to `setGeometry(...)`.
+   * With `BufferMode::POWER_OF_TWO`, the number of cells is rounded up to the next
+   * power of two in each direction, such that wrapping indices in the circular buffer
+   * and converting between linear and 2d indices reduce to bit operations. The map
+   * covers a larger area in this case (e.g. 256 instead of 200 cells per direction,
+   * about 64% more cells), the length of the map grows with the buffer.
+   * @param bufferMode the buffer mode.
+   */
+  void setBufferMode(const BufferMode bufferMode);
+
+  /*!
+   * Get the buffer mode of the grid map.
+   * @return the buffer mode.
+   */
+  BufferMode getBufferMode() const;
+
   /*!
    * Add a new empty data layer.
    * @param layer the name of the layer.
@@ -199,6 +218,26 @@ class GridMap
   Matrix::Scalar atPosition(const std::string& layer, const Position& position,
                    InterpolationMethods interpolationMethod = InterpolationMethods::INTER_NEAREST) const;
 
+  /*!
+   * Get cell data for a batch of positions. The layer is looked up only once and
+   * the conversion from positions to indices is done for all positions at once.
+   * Positions outside of the map do not throw but are flagged as invalid. If linear
+   * interpolation is requested and a position lacks the 2x2 neighborhood, the nearest
+   * cell is returned instead (as for `atPosition(...)`).
+   * @param[in] layer the name of the layer to be accessed.
+   * @param[in] positions the requested positions (one position per column).
+   * @param[out] values the data of the cells (unspecified for invalid positions).
+   * @param[out] isValid true if the position is inside the map, false otherwise.
+   * @param[in] interpolationMethod the interpolation method.
+   * @return the number of valid positions.
+   * @throw std::out_of_range if no map layer with name `layer` is present.
+   * @throw std::runtime_error if the specified interpolation method is not implemented.
+   */
+  size_t atPositions(const std::string& layer, const Eigen::Ref<const Eigen::Matrix2Xd>& positions,
+                     Eigen::Matrix<Matrix::Scalar, Eigen::Dynamic, 1>& values,
+                     Eigen::Array<bool, Eigen::Dynamic, 1>& isValid,
+                     InterpolationMethods interpolationMethod = InterpolationMethods::INTER_NEAREST) const;
+
   /*!
    * Get cell data for requested index.
    * @param layer the name of the layer to be accessed.
@@ -381,6 +420,17 @@ class GridMap
    */
   void clearAll();
 
+  /*!
+   * Sets all cells of a layer whose centers are inside a polygon to a value.
+   * The cells are found by scanline rasterization (see `PolygonRasterizer`) and
+   * filled column by column.
+   * @param layer the name of the layer.
+   * @param polygon the polygon.
+   * @param value the value to set.
+   * @throw std::out_of_range if no map layer with name `layer` is present.
+   */
+  void fillPolygon(const std::string& layer, const Polygon& polygon, const DataType value);
+
   /*!
    * Set the timestamp of the grid map.
    * @param timestamp the timestamp to set (in  nanoseconds).
@@ -434,6 +484,13 @@ class GridMap
    */
   const Size& getSize() const;
 
+  /*!
+   * Get the indexer for conversions between positions and indices. The indexer
+   * is kept up to date with the geometry of the map.
+   * @return the indexer of the grid map.
+   */
+  const GridIndexer& getIndexer() const;
+
   /*!
    * Set the start index of the circular buffer.
    * Use this method with caution!
@@ -483,6 +540,11 @@ class GridMap
    */
   bool atPositionLinearInterpolated(const std::string& layer, const Position& position, Matrix::Scalar &value) const;
 
+  /*!
+   * Updates the cached indexer after a change of the map geometry.
+   */
+  void updateIndexer();
+
   /*!
    * Resize the buffer.
    * @param bufferSize the requested buffer size.
@@ -518,9 +580,15 @@ class GridMap
   //! Size of the buffer (rows and cols of the data structure).
   Size size_;
 
+  //! Buffer mode used when setting the geometry.
+  BufferMode bufferMode_;
+
   //! Circular buffer start indeces.
   Index startIndex_;
 
+  //! Position/index conversions for the current geometry.
+  GridIndexer indexer_;
+
  public:
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 };
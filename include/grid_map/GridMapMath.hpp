@@ -10,6 +10,7 @@
 
 #include "grid_map/TypeDefs.hpp"
 #include "grid_map/BufferRegion.hpp"
+#include "grid_map/Span.hpp"
 
 #include <Eigen/Core>
 #include <vector>
@@ -144,6 +145,31 @@ void wrapIndexToRange(Index& index, const Size& bufferSize);
  */
 void wrapIndexToRange(int& index, const int& bufferSize);
 
+/*!
+ * Checks if a buffer size is a power of two, i.e. if indices can be wrapped with a bit mask.
+ * @param bufferSize the buffer size.
+ * @return true if the size is a power of two.
+ */
+inline bool isPowerOfTwo(const int bufferSize)
+{
+  return bufferSize > 0 && (bufferSize & (bufferSize - 1)) == 0;
+}
+
+/*!
+ * Gets the smallest power of two that is greater or equal to a buffer size.
+ * @param bufferSize the buffer size.
+ * @return the next power of two.
+ */
+int getNextPowerOfTwo(const int bufferSize);
+
+/*!
+ * Gets the base 2 logarithm of a power of two, i.e. the shift corresponding to a
+ * multiplication with it.
+ * @param powerOfTwo the power of two.
+ * @return the exponent.
+ */
+int getPowerOfTwoExponent(const int powerOfTwo);
+
 /*!
  * Bound (cuts off) the position to lie inside the map.
  * This means that an index that overflows is stopped at the last valid index.
@@ -217,6 +243,23 @@ bool getBufferRegionsForSubmap(std::vector<BufferRegion>& submapBufferRegions,
                                const Size& bufferSize,
                                const Index& bufferStartIndex = Index::Zero());
 
+/*!
+ * Computes the spans (contiguous runs of cells per column) in the circular buffer
+ * that make up a submap. Columns are listed in the order of the submap, a column
+ * that crosses the wrap of the buffer is split into two spans.
+ * @param[out] spans the list of spans that make up the submap.
+ * @param[in] submapIndex the index (top-left) for the requested submap.
+ * @param[in] submapBufferSize the size of the requested submap.
+ * @param[in] bufferSize the buffer size of the map.
+ * @param[in] bufferStartIndex the index of the starting point of the circular buffer (optional).
+ * @return true if successful, false if requested submap is not fully contained in the map.
+ */
+bool getSpansForSubmap(std::vector<Span>& spans,
+                       const Index& submapIndex,
+                       const Size& submapBufferSize,
+                       const Size& bufferSize,
+                       const Index& bufferStartIndex = Index::Zero());
+
 /*!
  * Increases the index by one to iterate through the map.
  * Increments either to the neighboring index to the right or to
@@ -0,0 +1,228 @@
+/*
+ * LayerAccessor.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include "grid_map/GridMap.hpp"
+#include "grid_map/GridIndexer.hpp"
+
+// Eigen
+#include <Eigen/Core>
+
+// STL
+#include <string>
+#include <type_traits>
+
+namespace grid_map {
+
+/*!
+ * Bounds policies for `LayerAccessor`. A policy resolves a (buffer) index or a
+ * position to a buffer index and reports whether the access is valid.
+ */
+namespace bounds {
+
+/*!
+ * No bounds checks at all, accesses compile down to a direct buffer load.
+ * The caller guarantees that indices/positions are within the map.
+ */
+struct Unchecked
+{
+  static bool resolveIndex(const GridIndexer& /*indexer*/, Index& /*index*/)
+  {
+    return true;
+  }
+
+  static bool resolvePosition(const GridIndexer& indexer, const Position& position, Index& index)
+  {
+    indexer.getIndexFromPosition(index, position);
+    return true;
+  }
+};
+
+/*!
+ * Accesses outside of the map are reported as misses (no exceptions).
+ */
+struct Checked
+{
+  static bool resolveIndex(const GridIndexer& indexer, Index& index)
+  {
+    const Size& size = indexer.getSize();
+    return index(0) >= 0 && index(1) >= 0 && index(0) < size(0) && index(1) < size(1);
+  }
+
+  static bool resolvePosition(const GridIndexer& indexer, const Position& position, Index& index)
+  {
+    return indexer.getIndexFromPosition(index, position);
+  }
+};
+
+/*!
+ * Accesses outside of the map are redirected to the closest cell on the map border.
+ * Buffer indices are bounded to the range of the buffer.
+ */
+struct Clamped
+{
+  static bool resolveIndex(const GridIndexer& indexer, Index& index)
+  {
+    index = index.max(0).min(indexer.getSize() - 1);
+    return true;
+  }
+
+  static bool resolvePosition(const GridIndexer& indexer, const Position& position, Index& index)
+  {
+    const Index unwrappedIndex = indexer.getIndexCoordinatesFromPosition(position).floor().cast<int>();
+    index = indexer.getBufferIndexFromIndex(unwrappedIndex.max(0).min(indexer.getSize() - 1));
+    return true;
+  }
+};
+
+/*!
+ * Accesses outside of the map wrap around (toroidal map). Useful for rolling
+ * windows where the circular buffer is treated as periodic.
+ */
+struct Wrapped
+{
+  static bool resolveIndex(const GridIndexer& indexer, Index& index)
+  {
+    index = indexer.wrapIndex(index);
+    return true;
+  }
+
+  static bool resolvePosition(const GridIndexer& indexer, const Position& position, Index& index)
+  {
+    const Index unwrappedIndex = indexer.getIndexCoordinatesFromPosition(position).floor().cast<int>();
+    index = indexer.wrapIndex(unwrappedIndex + indexer.getStartIndex());
+    return true;
+  }
+};
+
+} /* namespace bounds */
+
+/*!
+ * Non-throwing access to the cells of a single layer. The layer is looked up once
+ * at construction, and the accessors resolve indices/positions according to the
+ * bounds policy (see namespace `bounds`):
+ *
+ *   LayerAccessor<bounds::Checked> accessor(map, "obstacles");
+ *   DataType value;
+ *   if (accessor.getAtPosition(position, value)) { ... }
+ *
+ * `find(...)` returns a pointer to the cell, which is a null pointer on a miss of
+ * the `Checked` policy. Use a non-const scalar type for write access:
+ *
+ *   LayerAccessor<bounds::Unchecked, DataType> accessor(map, "obstacles");
+ *   *accessor.find(index) = LETHAL_OBSTACLE;
+ *
+ * Indices are buffer indices (as returned by `GridMap::getIndex(...)`). The accessor
+ * follows moves of the map, but is invalidated by changes of its size
+ * (`setGeometry(...)`, `extendToInclude(...)`) and by removing the layer.
+ */
+template<typename BoundsPolicy, typename Scalar = const DataType>
+class LayerAccessor
+{
+ public:
+  typedef typename std::conditional<std::is_const<Scalar>::value, const GridMap, GridMap>::type GridMapType;
+
+  /*!
+   * Constructor.
+   * @param map the grid map.
+   * @param layer the name of the layer to be accessed.
+   * @throw std::out_of_range if no map layer with name `layer` is present.
+   */
+  LayerAccessor(GridMapType& map, const std::string& layer)
+      : indexer_(map.getIndexer()),
+        data_(map.get(layer).data()),
+        rows_(map.getSize()(0))
+  {
+  }
+
+  /*!
+   * Get a pointer to the cell at a buffer index.
+   * @param index the buffer index, may be modified according to the bounds policy.
+   * @return the pointer to the cell, nullptr if not accessible.
+   */
+  Scalar* find(Index index) const
+  {
+    if (!BoundsPolicy::resolveIndex(indexer_, index)) return nullptr;
+    return data_ + index(1) * rows_ + index(0);
+  }
+
+  /*!
+   * Get a pointer to the cell containing a position.
+   * @param position the position in the map frame.
+   * @return the pointer to the cell, nullptr if not accessible.
+   */
+  Scalar* findAtPosition(const Position& position) const
+  {
+    Index index;
+    if (!BoundsPolicy::resolvePosition(indexer_, position, index)) return nullptr;
+    return data_ + index(1) * rows_ + index(0);
+  }
+
+  /*!
+   * Get the value of the cell at a buffer index.
+   * @param[in] index the buffer index.
+   * @param[out] value the value of the cell (unchanged on a miss).
+   * @return true if the cell is accessible.
+   */
+  bool get(const Index& index, DataType& value) const
+  {
+    const Scalar* cell = find(index);
+    if (cell == nullptr) return false;
+    value = *cell;
+    return true;
+  }
+
+  /*!
+   * Get the value of the cell containing a position.
+   * @param[in] position the position in the map frame.
+   * @param[out] value the value of the cell (unchanged on a miss).
+   * @return true if the cell is accessible.
+   */
+  bool getAtPosition(const Position& position, DataType& value) const
+  {
+    const Scalar* cell = findAtPosition(position);
+    if (cell == nullptr) return false;
+    value = *cell;
+    return true;
+  }
+
+  /*!
+   * Get the value of the cell at a buffer index, or a fallback value on a miss.
+   * @param index the buffer index.
+   * @param fallback the value returned if the cell is not accessible.
+   * @return the value of the cell.
+   */
+  DataType valueOr(const Index& index, const DataType fallback) const
+  {
+    const Scalar* cell = find(index);
+    return cell != nullptr ? *cell : fallback;
+  }
+
+  /*!
+   * Get the value of the cell containing a position, or a fallback value on a miss.
+   * @param position the position in the map frame.
+   * @param fallback the value returned if the cell is not accessible.
+   * @return the value of the cell.
+   */
+  DataType valueAtPositionOr(const Position& position, const DataType fallback) const
+  {
+    const Scalar* cell = findAtPosition(position);
+    return cell != nullptr ? *cell : fallback;
+  }
+
+ private:
+  //! Indexer of the grid map (follows moves of the map).
+  const GridIndexer& indexer_;
+
+  //! Data of the layer.
+  Scalar* data_;
+
+  //! Number of rows of the buffer (column-major storage).
+  Eigen::Index rows_;
+};
+
+} /* namespace grid_map */
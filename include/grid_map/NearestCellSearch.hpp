@@ -0,0 +1,76 @@
+/*
+ * NearestCellSearch.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include "grid_map/GridMap.hpp"
+#include "grid_map/GridIndexer.hpp"
+#include "grid_map/RingOffsetTable.hpp"
+
+// STL
+#include <cmath>
+#include <memory>
+#include <string>
+
+namespace grid_map {
+
+/*!
+ * Finds the cell closest to a position (by the distance to the cell center) whose
+ * value satisfies a predicate, e.g. the nearest free cell for goal correction.
+ * The cells are visited ring by ring with the shared `RingOffsetTable`, and the
+ * search stops as soon as no cell of the remaining rings can be closer than the
+ * best match. Ties are resolved in favor of the cell visited first.
+ * @param[in] map the grid map.
+ * @param[in] layer the name of the layer.
+ * @param[in] position the position to search from (may be outside of the map).
+ * @param[in] predicate the test on the cell value, called as `predicate(value)`.
+ * @param[in] maxRadius the maximum distance of the cell center to the position.
+ * @param[out] index the buffer index of the nearest matching cell.
+ * @return true if a matching cell was found.
+ */
+template<typename Predicate>
+bool findNearest(const GridMap& map, const std::string& layer, const Position& position,
+                 const Predicate& predicate, const double maxRadius, Index& index)
+{
+  const Matrix& data = map[layer];
+  const GridIndexer& indexer = map.getIndexer();
+  const double resolution = indexer.getResolution();
+  const Size& size = indexer.getSize();
+  if (maxRadius < 0.0 || (size == 0).any()) return false;
+
+  // Unwrapped index of the cell containing the position and the distance of the position to its center.
+  const Eigen::Array2d coordinates = indexer.getIndexCoordinatesFromPosition(position);
+  const Index center(static_cast<int>(std::floor(coordinates(0))), static_cast<int>(std::floor(coordinates(1))));
+  const double centerOffset = (coordinates - center.cast<double>() - 0.5).matrix().norm() * resolution;
+  Position firstCellPosition;
+  indexer.getPositionFromIndex(firstCellPosition, indexer.getBufferIndexFromIndex(Index::Zero()));
+
+  const unsigned int nRings = static_cast<unsigned int>(std::ceil(maxRadius / resolution)) + 1;
+  const std::shared_ptr<const RingOffsetTable> rings = RingOffsetTable::get(nRings);
+  double bestDistanceSquare = maxRadius * maxRadius;
+  bool isFound = false;
+  for (unsigned int ring = 0; ring <= nRings; ++ring) {
+    // Offsets of ring d have a norm of at least d cells.
+    const double lowerBound = ring * resolution - centerOffset;
+    if (lowerBound > 0.0 && lowerBound * lowerBound > bestDistanceSquare) break;
+    const Index* offsets = rings->getRing(ring);
+    for (size_t i = 0; i < rings->getRingSize(ring); ++i) {
+      const Index cell = center + offsets[i];
+      if ((cell < 0).any() || (cell >= size).any()) continue;
+      const Position cellPosition = firstCellPosition - (resolution * cell.cast<double>()).matrix();
+      const double distanceSquare = (cellPosition - position).squaredNorm();
+      if (distanceSquare > bestDistanceSquare || (isFound && distanceSquare == bestDistanceSquare)) continue;
+      const Index bufferIndex = indexer.getBufferIndexFromIndex(cell);
+      if (!predicate(data(bufferIndex(0), bufferIndex(1)))) continue;
+      bestDistanceSquare = distanceSquare;
+      index = bufferIndex;
+      isFound = true;
+    }
+  }
+  return isFound;
+}
+
+} /* namespace grid_map */
@@ -0,0 +1,67 @@
+/*
+ * Parallel.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include "grid_map/ThreadPool.hpp"
+
+// STL
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+
+namespace grid_map {
+
+/*!
+ * Resolves a requested number of threads.
+ * @param nThreads the requested number of threads, 0 for the number of hardware threads.
+ * @return the number of threads to use (at least 1).
+ */
+inline unsigned int resolveNumberOfThreads(const unsigned int nThreads)
+{
+  if (nThreads > 0) return nThreads;
+  const unsigned int nHardwareThreads = std::thread::hardware_concurrency();
+  return nHardwareThreads > 0 ? nHardwareThreads : 1;
+}
+
+/*!
+ * Calls a function for all indices of a range, distributed over the threads of the
+ * global thread pool. The range is split into chunks of `grainSize` indices that are
+ * handed out dynamically, such that uneven work per index is balanced. With one thread
+ * (or one chunk), the function is called in order on the calling thread.
+ * @param begin the first index.
+ * @param end the end (past the last index) of the range.
+ * @param nThreads the maximum number of threads, 0 for all threads of the pool.
+ * @param function the function, called as `function(i)`. Calls for different indices
+ *                 may run concurrently, the function must not throw.
+ * @param grainSize the number of indices handed out at once.
+ */
+template<typename Function>
+void parallelFor(const size_t begin, const size_t end, const unsigned int nThreads, const Function& function,
+                 const size_t grainSize = 256)
+{
+  if (end <= begin) return;
+  const size_t chunkSize = std::max<size_t>(grainSize, 1);
+  const size_t nChunks = (end - begin + chunkSize - 1) / chunkSize;
+  const size_t nWorkers = std::min<size_t>(resolveNumberOfThreads(nThreads), nChunks);
+  if (nWorkers <= 1) {
+    for (size_t i = begin; i < end; ++i) function(i);
+    return;
+  }
+
+  std::atomic<size_t> nextChunk(0);
+  auto worker = [&]() {
+    for (size_t chunk = nextChunk++; chunk < nChunks; chunk = nextChunk++) {
+      const size_t chunkBegin = begin + chunk * chunkSize;
+      const size_t chunkEnd = std::min(end, chunkBegin + chunkSize);
+      for (size_t i = chunkBegin; i < chunkEnd; ++i) function(i);
+    }
+  };
+  ThreadPool::getGlobalPool().run(nWorkers, [&](const size_t, const unsigned int) { worker(); });
+}
+
+} /* namespace grid_map */
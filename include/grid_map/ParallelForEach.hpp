@@ -0,0 +1,124 @@
+/*
+ * ParallelForEach.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include "grid_map/Span.hpp"
+#include "grid_map/ThreadPool.hpp"
+#include "grid_map/TypeDefs.hpp"
+
+// STL
+#include <cstddef>
+#include <vector>
+
+namespace grid_map {
+
+/*
+ * Parallel loops over regions of a map. A region is given as spans (contiguous runs of
+ * cells per column of the buffer, split at the wrap of the circular buffer), as returned
+ * by `getSpans(...)` of `GridMapIterator` (whole map), `SubmapIterator`, `CircleIterator`,
+ * `EllipseIterator` and `PolygonIterator`. The spans are split into chunks of about
+ * `grainSize` cells, which are distributed over the threads of a thread pool. Each cell
+ * is visited by exactly one thread, such that writing to the visited cells is race free.
+ */
+
+/*!
+ * Splits spans into chunks of about a given number of cells. Spans longer than the
+ * chunk size are cut, such that the work per chunk is balanced.
+ * @param[in] spans the spans of the region.
+ * @param[in] grainSize the number of cells per chunk.
+ * @param[out] pieces the spans cut to at most `grainSize` cells.
+ * @param[out] chunkBegins the first piece of each chunk, followed by the number of pieces.
+ */
+void getSpanChunks(const std::vector<Span>& spans, const size_t grainSize, std::vector<Span>& pieces,
+                   std::vector<size_t>& chunkBegins);
+
+/*!
+ * Calls a function for all spans of a region, distributed over a thread pool.
+ * @param spans the spans of the region.
+ * @param function the function, called as `function(span)` (with spans cut to chunks).
+ * @param threadPool the thread pool.
+ * @param grainSize the number of cells per chunk.
+ */
+template<typename Function>
+void parallelForEachSpan(const std::vector<Span>& spans, const Function& function,
+                         ThreadPool& threadPool = ThreadPool::getGlobalPool(), const size_t grainSize = 16384)
+{
+  std::vector<Span> pieces;
+  std::vector<size_t> chunkBegins;
+  getSpanChunks(spans, grainSize, pieces, chunkBegins);
+  threadPool.run(chunkBegins.size() - 1, [&](const size_t chunk, const unsigned int) {
+    for (size_t i = chunkBegins[chunk]; i < chunkBegins[chunk + 1]; ++i) function(pieces[i]);
+  });
+}
+
+/*!
+ * Calls a function for all cells of a region, distributed over a thread pool.
+ * @param spans the spans of the region.
+ * @param function the function, called as `function(index)` with the buffer index of the cell.
+ * @param threadPool the thread pool.
+ * @param grainSize the number of cells per chunk.
+ */
+template<typename Function>
+void parallelForEachCell(const std::vector<Span>& spans, const Function& function,
+                         ThreadPool& threadPool = ThreadPool::getGlobalPool(), const size_t grainSize = 16384)
+{
+  parallelForEachSpan(spans, [&function](const Span& span) {
+    Index index(span.getStartIndex());
+    for (const int rowEnd = span.rowStart + span.length; index(0) < rowEnd; ++index(0)) function(index);
+  }, threadPool, grainSize);
+}
+
+/*!
+ * Reduces all spans of a region in parallel. Each thread accumulates into its own
+ * result, the results of the threads are combined in the order of the threads.
+ * @param spans the spans of the region.
+ * @param identity the initial value of the result of each thread.
+ * @param function the function, called as `function(span, result)` to accumulate a span.
+ * @param combine the function combining two results, called as `combine(result, other)`.
+ * @param threadPool the thread pool.
+ * @param grainSize the number of cells per chunk.
+ * @return the combined result.
+ */
+template<typename Result, typename Function, typename Combine>
+Result parallelReduceSpans(const std::vector<Span>& spans, const Result& identity, const Function& function,
+                           const Combine& combine, ThreadPool& threadPool = ThreadPool::getGlobalPool(),
+                           const size_t grainSize = 16384)
+{
+  std::vector<Span> pieces;
+  std::vector<size_t> chunkBegins;
+  getSpanChunks(spans, grainSize, pieces, chunkBegins);
+  std::vector<Result> results(threadPool.getNumberOfThreads(), identity);
+  threadPool.run(chunkBegins.size() - 1, [&](const size_t chunk, const unsigned int thread) {
+    for (size_t i = chunkBegins[chunk]; i < chunkBegins[chunk + 1]; ++i) function(pieces[i], results[thread]);
+  });
+  Result result = results[0];
+  for (size_t i = 1; i < results.size(); ++i) result = combine(result, results[i]);
+  return result;
+}
+
+/*!
+ * Reduces all cells of a region in parallel (see `parallelReduceSpans(...)`).
+ * @param spans the spans of the region.
+ * @param identity the initial value of the result of each thread.
+ * @param function the function, called as `function(index, result)` with the buffer index of the cell.
+ * @param combine the function combining two results, called as `combine(result, other)`.
+ * @param threadPool the thread pool.
+ * @param grainSize the number of cells per chunk.
+ * @return the combined result.
+ */
+template<typename Result, typename Function, typename Combine>
+Result parallelReduceCells(const std::vector<Span>& spans, const Result& identity, const Function& function,
+                           const Combine& combine, ThreadPool& threadPool = ThreadPool::getGlobalPool(),
+                           const size_t grainSize = 16384)
+{
+  return parallelReduceSpans(spans, identity, [&function](const Span& span, Result& result) {
+    Index index(span.getStartIndex());
+    for (const int rowEnd = span.rowStart + span.length; index(0) < rowEnd; ++index(0)) function(index, result);
+  }, combine, threadPool, grainSize);
+}
+
+} /* namespace grid_map */
@@ -49,6 +49,26 @@ class Polygon
    */
   bool isInside(const Position& point) const;
 
+  /*!
+   * Batch version of `isInside(...)`. Points outside of the bounding box are rejected
+   * first, the remaining ones are tested in blocks against precomputed edge coefficients
+   * (vectorized over the points). Convex polygons are tested against the half-planes
+   * of `convertToInequalityConstraints(...)` instead of counting crossings. Points on
+   * the boundary may be classified differently than by `isInside(...)`.
+   * @param[in] points the points to be checked (one point per column).
+   * @param[out] isInside true if the point is inside, false otherwise.
+   * @return the number of points inside.
+   */
+  size_t isInside(const Eigen::Ref<const Eigen::Matrix2Xd>& points,
+                  Eigen::Array<bool, Eigen::Dynamic, 1>& isInside) const;
+
+  /*!
+   * Check if the polygon is convex, i.e. all turns have the same direction and
+   * the vertices wind around once. Collinear vertices are allowed.
+   * @return true if convex, false otherwise.
+   */
+  bool isConvex() const;
+
   /*!
    * Add a vertex to the polygon
    * @param vertex the point to be added.
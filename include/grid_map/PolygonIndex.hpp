@@ -0,0 +1,163 @@
+/*
+ * PolygonIndex.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include "grid_map/Polygon.hpp"
+#include "grid_map/TypeDefs.hpp"
+
+// STL
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace grid_map {
+
+/*!
+ * Spatial index over a set of polygons (keep-out zones, speed zones etc.), bucketed
+ * on a uniform grid. Each polygon is registered in all buckets its bounding box
+ * overlaps, such that a point query only looks at the polygons of one bucket and a
+ * box query at the polygons of the buckets the box overlaps. Good bucket sizes are a
+ * multiple of the map resolution in the order of the typical polygon size.
+ *
+ * Polygons whose bounding box covers more than `getMaxBucketsPerPolygon()` buckets
+ * are not bucketed but tested on every query.
+ *
+ * Polygons are referred to by the id returned on insertion. Ids of removed polygons
+ * are reused by later insertions.
+ */
+class PolygonIndex
+{
+ public:
+
+  typedef size_t Id;
+
+  /*!
+   * Constructor.
+   * @param bucketSize the side length of the (square) buckets.
+   * @param maxBucketsPerPolygon the maximum number of buckets a polygon is registered in.
+   */
+  PolygonIndex(const double bucketSize, const size_t maxBucketsPerPolygon = 256);
+
+  /*!
+   * Insert a polygon.
+   * @param polygon the polygon to insert.
+   * @return the id of the polygon.
+   */
+  Id insert(const Polygon& polygon);
+
+  /*!
+   * Bulk load a set of polygons. Equivalent to inserting them one by one, but
+   * reserves the storage for all of them first.
+   * @param polygons the polygons to insert.
+   * @param[out] ids the ids of the polygons (same order), can be nullptr.
+   */
+  void insert(const std::vector<Polygon>& polygons, std::vector<Id>* ids = nullptr);
+
+  /*!
+   * Remove a polygon.
+   * @param id the id of the polygon.
+   * @return true if removed, false if there is no polygon with this id.
+   */
+  bool remove(const Id id);
+
+  /*!
+   * Remove all polygons.
+   */
+  void clear();
+
+  /*!
+   * Check if there is a polygon with this id.
+   * @param id the id of the polygon.
+   * @return true if the polygon exists, false otherwise.
+   */
+  bool exists(const Id id) const;
+
+  /*!
+   * Get a polygon. The id has to exist.
+   * @param id the id of the polygon.
+   * @return the polygon.
+   */
+  const Polygon& getPolygon(const Id id) const;
+
+  /*!
+   * Get the number of polygons.
+   * @return the number of polygons.
+   */
+  size_t size() const;
+
+  /*!
+   * Get the bucket size.
+   * @return the side length of the buckets.
+   */
+  double getBucketSize() const;
+
+  /*!
+   * Get the maximum number of buckets a polygon is registered in.
+   * @return the maximum number of buckets per polygon.
+   */
+  size_t getMaxBucketsPerPolygon() const;
+
+  /*!
+   * Find the polygons containing a point (as `Polygon::isInside(...)`).
+   * @param point the point to query.
+   * @param[out] ids the ids of the polygons containing the point (in ascending order).
+   * @return true if at least one polygon contains the point.
+   */
+  bool getContaining(const Position& point, std::vector<Id>& ids) const;
+
+  /*!
+   * Find the polygons intersecting an axis aligned box, i.e. polygons that contain
+   * a point of the box. To query a cell of a map, pass the cell center -/+ half the
+   * resolution.
+   * @param boxMin the minimal corner of the box.
+   * @param boxMax the maximal corner of the box.
+   * @param[out] ids the ids of the intersecting polygons (in ascending order).
+   * @return true if at least one polygon intersects the box.
+   */
+  bool getIntersecting(const Position& boxMin, const Position& boxMax, std::vector<Id>& ids) const;
+
+ private:
+
+  struct Entry
+  {
+    Polygon polygon;
+    Eigen::Array2d boxMin;
+    Eigen::Array2d boxMax;
+    bool isBucketed;
+    bool isValid;
+  };
+
+  //! Range of buckets [min, max] overlapped by a box.
+  void getBucketRange(const Eigen::Array2d& boxMin, const Eigen::Array2d& boxMax,
+                      Eigen::Array2i& bucketMin, Eigen::Array2i& bucketMax) const;
+
+  //! Key of a bucket in the hash map.
+  static int64_t getKey(const int x, const int y);
+
+  //! True if a polygon intersects a box, given that their bounding boxes overlap.
+  static bool intersects(const Polygon& polygon, const Eigen::Array2d& boxMin,
+                         const Eigen::Array2d& boxMax);
+
+  //! Side length of the buckets.
+  double bucketSize_;
+
+  //! Polygons covering more buckets than this are not bucketed.
+  size_t maxBucketsPerPolygon_;
+
+  //! Polygons by id, with the ids of removed polygons in the free list.
+  std::vector<Entry> entries_;
+  std::vector<Id> freeIds_;
+
+  //! Ids of the polygons overlapping each (non-empty) bucket.
+  std::unordered_map<int64_t, std::vector<Id>> buckets_;
+
+  //! Ids of the polygons which are not bucketed.
+  std::vector<Id> unbucketed_;
+};
+
+} /* namespace grid_map */
@@ -0,0 +1,98 @@
+/*
+ * PolygonRasterizer.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include "grid_map/GridMap.hpp"
+#include "grid_map/GridIndexer.hpp"
+#include "grid_map/Polygon.hpp"
+#include "grid_map/Span.hpp"
+
+// STL
+#include <vector>
+
+namespace grid_map {
+
+/*!
+ * Scanline rasterization of polygons on a grid map. The edges of the polygon are
+ * kept in an edge table sorted along the columns of the map, such that each column
+ * only intersects the edges crossing it. The inside intervals of a column follow
+ * from the sorted intersections, the cost is proportional to the number of covered
+ * cells plus the number of edges per column.
+ *
+ * The result is exact with respect to `Polygon::isInside(...)` evaluated at the
+ * cell centers: the intersections are computed with the same expressions, and the
+ * interval ends are corrected against the cell center positions.
+ */
+class PolygonRasterizer
+{
+ public:
+
+  /*!
+   * Constructor.
+   * @param gridMap the grid map to rasterize on (only the geometry is used).
+   */
+  PolygonRasterizer(const GridMap& gridMap);
+
+  /*!
+   * Constructor.
+   * @param indexer the geometry of the grid map to rasterize on.
+   */
+  PolygonRasterizer(const GridIndexer& indexer);
+
+  /*!
+   * Computes the cells inside a polygon as spans per column of the buffer.
+   * @param[in] polygon the polygon.
+   * @param[out] spans the spans in buffer indices, split at the wrap of the buffer.
+   */
+  void getSpans(const Polygon& polygon, std::vector<Span>& spans) const;
+
+  /*!
+   * Computes the cells inside a polygon as runs per row, ordered row by row (as
+   * iterated by `SubmapIterator`).
+   * @param[in] polygon the polygon.
+   * @param[out] rowSpans the runs in unwrapped indices.
+   */
+  void getRowSpans(const Polygon& polygon, std::vector<RowSpan>& rowSpans) const;
+
+  /*!
+   * Get the indexer of the map geometry used for rasterization.
+   * @return the indexer.
+   */
+  const GridIndexer& getIndexer() const;
+
+ private:
+
+  /*!
+   * Computes the inside intervals per column in unwrapped indices.
+   * @param[in] polygon the polygon.
+   * @param[out] spans the spans in unwrapped indices, ordered by column.
+   */
+  void getUnwrappedSpans(const Polygon& polygon, std::vector<Span>& spans) const;
+
+  /*!
+   * Computes the submap (in unwrapped indices) that contains the bounding box of a polygon.
+   * @param[in] polygon the polygon.
+   * @param[out] startIndex the unwrapped start index of the submap.
+   * @param[out] size the size of the submap.
+   */
+  void getBoundingSubmap(const Polygon& polygon, Index& startIndex, Size& size) const;
+
+  /*!
+   * Gets the position of the center of a cell given by its unwrapped index.
+   * @param index the unwrapped index.
+   * @return the position of the cell center.
+   */
+  Position getCellPosition(const Index& index) const;
+
+  //! Geometry of the grid map.
+  GridIndexer indexer_;
+
+ public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+} /* namespace grid_map */
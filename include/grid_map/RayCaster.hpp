@@ -0,0 +1,275 @@
+/*
+ * RayCaster.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include "grid_map/GridMap.hpp"
+#include "grid_map/GridIndexer.hpp"
+#include "grid_map/Parallel.hpp"
+
+// Eigen
+#include <Eigen/Core>
+
+// STL
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+namespace grid_map {
+
+/*!
+ * Cell traversal of a ray.
+ */
+enum class RayTraversal
+{
+  //! Bresenham line, the cells of `LineIterator` including its clipping (8-connected).
+  BRESENHAM,
+  //! Amanatides-Woo traversal, every cell the ray passes through (4-connected).
+  EXACT
+};
+
+/*!
+ * Batched ray casting from an origin to many endpoints (e.g. the beams of a laser scan).
+ * The geometry of the map is captured once, the rays are traversed in unwrapped
+ * index space without per-cell position lookups and are distributed over threads.
+ * Rays are clipped to the map, rays that miss the map visit no cells.
+ */
+class RayCaster
+{
+ public:
+
+  /*!
+   * Constructor.
+   * @param gridMap the grid map to cast rays on (only the geometry is used).
+   * @param traversal the cell traversal of the rays.
+   */
+  RayCaster(const GridMap& gridMap, const RayTraversal traversal = RayTraversal::BRESENHAM);
+
+  /*!
+   * Sets the number of threads used for batches of rays.
+   * @param nThreads the number of threads, 0 for the number of hardware threads (default is 1).
+   */
+  void setNumberOfThreads(const unsigned int nThreads);
+
+  /*!
+   * Get the number of threads used for batches of rays.
+   * @return the number of threads, 0 for the number of hardware threads.
+   */
+  unsigned int getNumberOfThreads() const;
+
+  /*!
+   * Get the cell traversal of the rays.
+   * @return the traversal.
+   */
+  RayTraversal getTraversal() const;
+
+  /*!
+   * Get the indexer of the map geometry.
+   * @return the indexer.
+   */
+  const GridIndexer& getIndexer() const;
+
+  /*!
+   * Traverses the cells of a single ray, from the start to the end.
+   * @param start the start position of the ray.
+   * @param end the end position of the ray.
+   * @param visitor called as `visitor(index)` with the buffer index of each cell,
+   *                returning false stops the traversal.
+   * @return false if the ray does not intersect the map.
+   */
+  template<typename Visitor>
+  bool castRay(const Position& start, const Position& end, const Visitor& visitor) const;
+
+  /*!
+   * Traverses the cells of a batch of rays from a common origin.
+   * @param origin the origin of the rays.
+   * @param endpoints the end positions of the rays.
+   * @param visitor called as `visitor(ray, index)` with the number of the ray and the
+   *                buffer index of each cell, returning false stops the ray. Calls for
+   *                different rays may run concurrently.
+   */
+  template<typename Visitor>
+  void castRays(const Position& origin, const std::vector<Position>& endpoints, const Visitor& visitor) const;
+
+  /*!
+   * Computes the maximum value along each ray (e.g. the maximum cost for line of sight checks).
+   * @param[in] data the layer data.
+   * @param[in] origin the origin of the rays.
+   * @param[in] endpoints the end positions of the rays.
+   * @param[out] maxValues the maximum value per ray, 0 for rays outside of the map.
+   */
+  void getMaxValues(const Matrix& data, const Position& origin, const std::vector<Position>& endpoints,
+                    std::vector<DataType>& maxValues) const;
+
+  /*!
+   * Computes the sum of the values along each ray.
+   * @param[in] data the layer data.
+   * @param[in] origin the origin of the rays.
+   * @param[in] endpoints the end positions of the rays.
+   * @param[out] sums the sum of the values per ray, 0 for rays outside of the map.
+   */
+  void getValueSums(const Matrix& data, const Position& origin, const std::vector<Position>& endpoints,
+                    std::vector<double>& sums) const;
+
+  /*!
+   * Finds the first cell along each ray with a value of at least a threshold.
+   * @param[in] data the layer data.
+   * @param[in] origin the origin of the rays.
+   * @param[in] endpoints the end positions of the rays.
+   * @param[in] threshold the value of a hit.
+   * @param[out] hits the buffer index of the first hit per ray, (-1, -1) if the ray has no hit.
+   * @return the number of rays with a hit.
+   */
+  size_t getFirstHits(const Matrix& data, const Position& origin, const std::vector<Position>& endpoints,
+                      const DataType threshold, std::vector<Index>& hits) const;
+
+ private:
+
+  /*!
+   * Clips a ray to the map in continuous index coordinates.
+   * @param[in/out] start the start of the ray.
+   * @param[in/out] end the end of the ray.
+   * @return false if the ray does not intersect the map.
+   */
+  bool clipToMap(Eigen::Array2d& start, Eigen::Array2d& end) const;
+
+  /*!
+   * Gets the first cell of a ray inside the map, limited as by `LineIterator`.
+   * @param[in] start the start of the ray.
+   * @param[in] end the end of the ray.
+   * @param[out] index the unwrapped index of the cell.
+   * @return false if the ray does not intersect the map.
+   */
+  bool getIndexLimitedToMap(const Position& start, const Position& end, Index& index) const;
+
+  /*!
+   * Traverses the cells of a Bresenham line between two cells.
+   * @param start the unwrapped start index.
+   * @param end the unwrapped end index.
+   * @param visitor the visitor (see `castRay(...)`).
+   */
+  template<typename Visitor>
+  void traverseBresenham(const Index& start, const Index& end, const Visitor& visitor) const;
+
+  /*!
+   * Traverses all cells a ray passes through (Amanatides-Woo).
+   * @param start the start in continuous index coordinates.
+   * @param end the end in continuous index coordinates.
+   * @param visitor the visitor (see `castRay(...)`).
+   */
+  template<typename Visitor>
+  void traverseExact(const Eigen::Array2d& start, const Eigen::Array2d& end, const Visitor& visitor) const;
+
+  /*!
+   * Moves a buffer index by one cell along an axis, wrapping around the buffer.
+   * @param index the buffer index.
+   * @param axis the axis (0 or 1).
+   * @param step the step (-1 or 1).
+   */
+  void stepBufferIndex(Index& index, const int axis, const int step) const
+  {
+    index(axis) += step;
+    if (index(axis) >= indexer_.getSize()(axis)) index(axis) = 0;
+    else if (index(axis) < 0) index(axis) = indexer_.getSize()(axis) - 1;
+  }
+
+  //! Geometry of the grid map.
+  GridIndexer indexer_;
+
+  //! Cell traversal of the rays.
+  RayTraversal traversal_;
+
+  //! Number of threads for batches of rays.
+  unsigned int nThreads_;
+
+ public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+template<typename Visitor>
+bool RayCaster::castRay(const Position& start, const Position& end, const Visitor& visitor) const
+{
+  if (traversal_ == RayTraversal::EXACT) {
+    Eigen::Array2d startCoordinates = indexer_.getIndexCoordinatesFromPosition(start);
+    Eigen::Array2d endCoordinates = indexer_.getIndexCoordinatesFromPosition(end);
+    if (!clipToMap(startCoordinates, endCoordinates)) return false;
+    traverseExact(startCoordinates, endCoordinates, visitor);
+  } else {
+    Index startIndex, endIndex;
+    if (!getIndexLimitedToMap(start, end, startIndex) || !getIndexLimitedToMap(end, start, endIndex)) return false;
+    traverseBresenham(startIndex, endIndex, visitor);
+  }
+  return true;
+}
+
+template<typename Visitor>
+void RayCaster::castRays(const Position& origin, const std::vector<Position>& endpoints, const Visitor& visitor) const
+{
+  parallelFor(0, endpoints.size(), nThreads_, [&](const size_t ray) {
+    castRay(origin, endpoints[ray], [&](const Index& index) { return visitor(ray, index); });
+  });
+}
+
+template<typename Visitor>
+void RayCaster::traverseBresenham(const Index& start, const Index& end, const Visitor& visitor) const
+{
+  // Same stepping as `LineIterator`.
+  const Size delta = (end - start).abs();
+  const Index direction((end(0) >= start(0)) ? 1 : -1, (end(1) >= start(1)) ? 1 : -1);
+  const int major = (delta(0) >= delta(1)) ? 0 : 1;
+  const int minor = 1 - major;
+  const int denominator = delta(major);
+  const int numeratorAdd = delta(minor);
+  int numerator = delta(major) / 2;
+  Index index = indexer_.getBufferIndexFromIndex(start);
+  for (int i = 0; i <= delta(major); ++i) {
+    if (!visitor(index)) return;
+    numerator += numeratorAdd;
+    if (numerator >= denominator) {
+      numerator -= denominator;
+      stepBufferIndex(index, minor, direction(minor));
+    }
+    stepBufferIndex(index, major, direction(major));
+  }
+}
+
+template<typename Visitor>
+void RayCaster::traverseExact(const Eigen::Array2d& start, const Eigen::Array2d& end, const Visitor& visitor) const
+{
+  Index index = start.floor().cast<int>();
+  const Index endIndex = end.floor().cast<int>();
+  const Eigen::Array2d direction = end - start;
+  Index step;
+  Eigen::Array2d tMax, tDelta;
+  for (int i = 0; i < 2; ++i) {
+    if (direction(i) > 0.0) {
+      step(i) = 1;
+      tDelta(i) = 1.0 / direction(i);
+      tMax(i) = (index(i) + 1 - start(i)) * tDelta(i);
+    } else if (direction(i) < 0.0) {
+      step(i) = -1;
+      tDelta(i) = -1.0 / direction(i);
+      tMax(i) = (start(i) - index(i)) * tDelta(i);
+    } else {
+      step(i) = 0;
+      tDelta(i) = tMax(i) = std::numeric_limits<double>::infinity();
+    }
+  }
+
+  // Exactly one step per crossed cell border, such that the end cell is always reached.
+  const int nCells = (endIndex - index).abs().sum() + 1;
+  Index bufferIndex = indexer_.getBufferIndexFromIndex(index);
+  for (int i = 0; i < nCells; ++i) {
+    if (!visitor(bufferIndex)) return;
+    const int axis = (index(0) == endIndex(0)) ? 1 : (index(1) == endIndex(1)) ? 0 : (tMax(0) < tMax(1)) ? 0 : 1;
+    index(axis) += step(axis);
+    tMax(axis) += tDelta(axis);
+    stepBufferIndex(bufferIndex, axis, step(axis));
+  }
+}
+
+} /* namespace grid_map */
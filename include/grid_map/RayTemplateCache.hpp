@@ -0,0 +1,110 @@
+/*
+ * RayTemplateCache.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include "grid_map/TypeDefs.hpp"
+
+// STL
+#include <cstddef>
+#include <vector>
+
+namespace grid_map {
+
+/*!
+ * Precomputed ray templates for a sensor with a fixed beam layout. From an origin
+ * at a cell center, the cells a beam crosses are translation invariant, so each
+ * beam is stored once as the list of index offsets `LineIterator` visits from the
+ * origin cell to the end of the beam at the maximum range. Together with each
+ * offset, the distance of the cell center along the beam is stored, such that a
+ * shorter measurement walks a prefix of the template.
+ *
+ * The templates depend on the map resolution and are rebuilt by `update(...)`
+ * whenever the resolution changes.
+ */
+class RayTemplateCache
+{
+ public:
+
+  /*!
+   * Constructor. The templates are built on the first call to `update(...)`.
+   * @param angles the angles of the beams in the map frame (in [rad]).
+   * @param maxRange the maximum range of the beams.
+   */
+  RayTemplateCache(const std::vector<double>& angles, const double maxRange);
+
+  /*!
+   * Rebuilds the templates if the resolution changed.
+   * @param resolution the resolution of the map.
+   * @return true if the templates were rebuilt.
+   */
+  bool update(const double resolution);
+
+  /*!
+   * Get the resolution the templates were built for.
+   * @return the resolution, 0 if not built yet.
+   */
+  double getResolution() const;
+
+  /*!
+   * Get the maximum range of the beams.
+   * @return the maximum range.
+   */
+  double getMaxRange() const;
+
+  /*!
+   * Get the number of beams.
+   * @return the number of beams.
+   */
+  size_t getNumberOfBeams() const;
+
+  /*!
+   * Get the angle of a beam.
+   * @param beam the number of the beam.
+   * @return the angle of the beam (in [rad]).
+   */
+  double getAngle(const size_t beam) const;
+
+  /*!
+   * Get the number of cells of the template of a beam.
+   * @param beam the number of the beam.
+   * @return the number of cells.
+   */
+  size_t getRaySize(const size_t beam) const;
+
+  /*!
+   * Get the index offsets of the template of a beam (relative to the origin cell, in
+   * unwrapped indices), starting with the origin cell.
+   * @param beam the number of the beam.
+   * @return the pointer to the first offset.
+   */
+  const Index* getRayOffsets(const size_t beam) const;
+
+  /*!
+   * Get the distances of the cell centers along a beam, for each offset of the template.
+   * @param beam the number of the beam.
+   * @return the pointer to the first distance.
+   */
+  const float* getRayDistances(const size_t beam) const;
+
+ private:
+
+  //! Beam layout.
+  std::vector<double> angles_;
+  double maxRange_;
+
+  //! Resolution of the templates.
+  double resolution_;
+
+  //! Offsets and distances of all templates, beam by beam.
+  std::vector<Index> offsets_;
+  std::vector<float> distances_;
+
+  //! Start of each template (one more entry than beams).
+  std::vector<size_t> rayStarts_;
+};
+
+} /* namespace grid_map */
@@ -0,0 +1,95 @@
+/*
+ * RingOffsetTable.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include "grid_map/TypeDefs.hpp"
+
+// STL
+#include <memory>
+#include <vector>
+
+namespace grid_map {
+
+/*!
+ * Translation invariant table of the index offsets of the rings around a cell, as
+ * traversed by the `SpiralIterator`. Ring d contains the offsets o with
+ * floor(|o|) = d (ring 0 is the cell itself), in the order of the spiral.
+ *
+ * The table only depends on the number of rings and is shared between all users:
+ * `get(...)` returns the cached table, which is extended (and replaced in the cache)
+ * when more rings are requested. Tables handed out before stay valid.
+ *
+ * The cached table holds about pi * nRings^2 offsets, so it is capped at
+ * `maxCachedRings` (about 1.6 MB). Larger tables are built for the caller only
+ * and freed with their last user.
+ */
+class RingOffsetTable
+{
+ public:
+
+  //! Largest number of rings of the cached table.
+  static constexpr unsigned int maxCachedRings = 256;
+
+  /*!
+   * Get the shared table with at least a number of rings.
+   * @param nRings the largest ring distance (in cells) needed.
+   * @return the table.
+   */
+  static std::shared_ptr<const RingOffsetTable> get(const unsigned int nRings);
+
+  /*!
+   * Get the largest ring distance contained in the table.
+   * @return the number of rings (not counting ring 0).
+   */
+  unsigned int getNumberOfRings() const
+  {
+    return ringStarts_.size() - 2;
+  }
+
+  /*!
+   * Get the number of offsets of a ring.
+   * @param ring the ring distance (in cells).
+   * @return the number of offsets.
+   */
+  size_t getRingSize(const unsigned int ring) const
+  {
+    return ringStarts_[ring + 1] - ringStarts_[ring];
+  }
+
+  /*!
+   * Get the offsets of a ring.
+   * @param ring the ring distance (in cells).
+   * @return the pointer to the first offset of the ring.
+   */
+  const Index* getRing(const unsigned int ring) const
+  {
+    return offsets_.data() + ringStarts_[ring];
+  }
+
+ private:
+
+  /*!
+   * Constructor.
+   * @param nRings the largest ring distance.
+   * @param base a smaller table to extend, can be nullptr.
+   */
+  RingOffsetTable(const unsigned int nRings, const RingOffsetTable* base);
+
+  /*!
+   * Appends the offsets of a ring to the table.
+   * @param ring the ring distance (in cells).
+   */
+  void generateRing(const unsigned int ring);
+
+  //! Offsets of all rings, ring by ring.
+  std::vector<Index> offsets_;
+
+  //! Start of each ring in the offsets (one more entry than rings).
+  std::vector<size_t> ringStarts_;
+};
+
+} /* namespace grid_map */
@@ -0,0 +1,123 @@
+/*
+ * SlidingWindowFilter.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include "grid_map/GridMap.hpp"
+#include "grid_map/iterators/SlidingWindowIterator.hpp"
+
+// Eigen
+#include <Eigen/Core>
+
+// STL
+#include <string>
+#include <vector>
+
+namespace grid_map {
+
+/*!
+ * Computes statistics of a layer over a square sliding window around each cell,
+ * e.g. the maximum cost in the neighborhood of each cell. The window is separated
+ * into a pass along the rows and a pass along the columns. Minimum and maximum are
+ * tracked with monotonic deques and the mean with running sums, such that the cost
+ * per cell is independent of the window size (in contrast to copying the window
+ * data for each cell with `SlidingWindowIterator::getData()`).
+ *
+ * The edge handling modes of `SlidingWindowIterator` are honored:
+ *  - INSIDE: only cells with a full window are written.
+ *  - CROP: the window is cropped to the map.
+ *  - EMPTY: the missing cells are empty and ignored (same statistics as CROP).
+ *  - MEAN: the missing cells are filled with the mean of the window, which leaves
+ *          minimum, maximum and mean unchanged but counts the full window.
+ *
+ * Maps with a circular buffer offset are filtered directly on the buffer (without
+ * converting to the default start index), the windows follow the unwrapped indices
+ * across the seams of the buffer.
+ */
+class SlidingWindowFilter
+{
+ public:
+
+  typedef SlidingWindowIterator::EdgeHandling EdgeHandling;
+
+  /*!
+   * The statistic to compute over the window.
+   */
+  enum class Statistic
+  {
+    MIN,
+    MAX,
+    MEAN,
+    COUNT // Number of cells in the window (saturated to the range of the data type).
+  };
+
+  /*!
+   * Constructor.
+   * @param windowSize the size of the window in number of cells (has to be an odd number!).
+   * @param edgeHandling the method to handle edges of the map.
+   */
+  SlidingWindowFilter(const size_t windowSize = 3, const EdgeHandling& edgeHandling = EdgeHandling::CROP);
+
+  /*!
+   * Set the side length of the window (in m), rounded like `SlidingWindowIterator::setWindowLength(...)`.
+   * @param gridMap the grid map to filter.
+   * @param windowLength the side length of the window (in m).
+   */
+  void setWindowLength(const GridMap& gridMap, const double windowLength);
+
+  /*!
+   * Get the size of the window in number of cells.
+   * @return the size of the window.
+   */
+  size_t getWindowSize() const;
+
+  /*!
+   * Computes a statistic of a layer and writes it to another layer (which is added if
+   * not present). Source and destination can be the same layer.
+   * @param gridMap the grid map.
+   * @param layer the source layer.
+   * @param destinationLayer the destination layer.
+   * @param statistic the statistic to compute.
+   * @throw std::out_of_range if no map layer with name `layer` is present.
+   */
+  void filter(GridMap& gridMap, const std::string& layer, const std::string& destinationLayer,
+              const Statistic statistic);
+
+  /*!
+   * Computes a statistic of a data matrix stored as circular buffer.
+   * @param[in] data the source data.
+   * @param[in/out] result the destination data, same size as the source.
+   * @param[in] statistic the statistic to compute.
+   * @param[in] bufferStartIndex the start index of the circular buffer.
+   */
+  void filter(const Matrix& data, Matrix& result, const Statistic statistic,
+              const Index& bufferStartIndex = Index::Zero());
+
+ private:
+
+  /*!
+   * Writes the result of the column pass to the destination, respecting the edge handling.
+   * @param[out] result the destination data.
+   * @param[in] bufferStartIndex the start index of the circular buffer.
+   */
+  void writeResult(Matrix& result, const Index& bufferStartIndex) const;
+
+  //! Size of the window and of the border of the window around the center cell.
+  size_t windowSize_;
+  int windowMargin_;
+
+  //! Edge handling method.
+  EdgeHandling edgeHandling_;
+
+  //! Intermediate results of the row and column passes (reused between calls).
+  Matrix extremumBuffer_;
+  Matrix resultBuffer_;
+  Eigen::MatrixXd sumBuffer_;
+  Eigen::VectorXd columnSum_;
+  std::vector<int> deque_;
+};
+
+} /* namespace grid_map */
@@ -0,0 +1,174 @@
+/*
+ * Span.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include "grid_map/TypeDefs.hpp"
+
+// Eigen
+#include <Eigen/Core>
+
+// STL
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace grid_map {
+
+/*!
+ * A run of contiguous cells in one column of the circular buffer. As the layers
+ * are stored column-major, the cells of a span are adjacent in memory and can be
+ * filled or reduced as a block (e.g. `span.segment(map["layer"]).setConstant(0)`).
+ * Spans are expressed in buffer indices and never cross the wrap of the buffer.
+ */
+struct Span
+{
+  Span()
+      : column(0),
+        rowStart(0),
+        length(0)
+  {
+  }
+
+  Span(const int column, const int rowStart, const int length)
+      : column(column),
+        rowStart(rowStart),
+        length(length)
+  {
+  }
+
+  /*!
+   * Get the buffer index of the first cell of the span.
+   * @return the buffer index of the first cell.
+   */
+  Index getStartIndex() const
+  {
+    return Index(rowStart, column);
+  }
+
+  /*!
+   * Get a pointer to the first cell of the span in a layer.
+   * @param data the layer data.
+   * @return the pointer to the first cell.
+   */
+  DataType* data(Matrix& data) const
+  {
+    return data.data() + static_cast<Eigen::Index>(column) * data.rows() + rowStart;
+  }
+
+  const DataType* data(const Matrix& data) const
+  {
+    return data.data() + static_cast<Eigen::Index>(column) * data.rows() + rowStart;
+  }
+
+  /*!
+   * Get the cells of the span in a layer as Eigen vector.
+   * @param data the layer data.
+   * @return the mapped cells of the span.
+   */
+  Eigen::Map<Eigen::Matrix<DataType, Eigen::Dynamic, 1>> segment(Matrix& data) const
+  {
+    return Eigen::Map<Eigen::Matrix<DataType, Eigen::Dynamic, 1>>(this->data(data), length);
+  }
+
+  Eigen::Map<const Eigen::Matrix<DataType, Eigen::Dynamic, 1>> segment(const Matrix& data) const
+  {
+    return Eigen::Map<const Eigen::Matrix<DataType, Eigen::Dynamic, 1>>(this->data(data), length);
+  }
+
+  //! Column of the span in the buffer.
+  int column;
+
+  //! Row of the first cell of the span in the buffer.
+  int rowStart;
+
+  //! Number of cells of the span.
+  int length;
+};
+
+/*!
+ * A run of contiguous cells in one row, in unwrapped indices (i.e. the index of
+ * a grid map with no circular buffer offset). Used to visit cells row by row.
+ */
+struct RowSpan
+{
+  RowSpan(const int row, const int columnStart, const int length)
+      : row(row),
+        columnStart(columnStart),
+        length(length)
+  {
+  }
+
+  //! Row of the run (unwrapped).
+  int row;
+
+  //! Column of the first cell of the run (unwrapped).
+  int columnStart;
+
+  //! Number of cells of the run.
+  int length;
+};
+
+/*!
+ * Computes the interval of cells on a line of the grid (a row or a column) that
+ * lie inside a convex shape. The interval is estimated first (e.g. analytically from
+ * the shape equation, at most one cell too small at each end) and the ends are then
+ * corrected against the inside test of the shape. Non-finite estimates fall back to
+ * testing the whole range.
+ * @param[in] estimateBegin estimate of the first inside cell (continuous cell coordinate).
+ * @param[in] estimateEnd estimate of the last inside cell (continuous cell coordinate).
+ * @param[in] lowerBound the first cell of the line to consider.
+ * @param[in] upperBound the end (past the last cell) of the line to consider.
+ * @param[in] isInside the inside test, called with the cell coordinate along the line.
+ * @param[out] begin the first inside cell.
+ * @param[out] end the end (past the last inside cell) of the interval.
+ * @return true if the interval is not empty.
+ */
+template<typename Predicate>
+bool refineInterval(const double estimateBegin, const double estimateEnd, const int lowerBound,
+                    const int upperBound, const Predicate& isInside, int& begin, int& end)
+{
+  if (std::isfinite(estimateBegin) && std::isfinite(estimateEnd)) {
+    const double lower = lowerBound, upper = upperBound;
+    begin = static_cast<int>(std::max(lower, std::min(upper, std::floor(estimateBegin))));
+    end = static_cast<int>(std::max(lower, std::min(upper, std::ceil(estimateEnd) + 1.0)));
+  } else {
+    begin = lowerBound;
+    end = upperBound;
+  }
+  while (begin < end && !isInside(begin)) ++begin;
+  while (end > begin && !isInside(end - 1)) --end;
+  if (begin == end) return false;
+  while (begin > lowerBound && isInside(begin - 1)) --begin;
+  while (end < upperBound && isInside(end)) ++end;
+  return true;
+}
+
+/*!
+ * Splits spans into the runs of cells that satisfy a predicate.
+ * @param[in] spans the spans to be split.
+ * @param[in] isInside the predicate, called with the buffer index of each cell.
+ * @param[out] filteredSpans the runs of cells for which the predicate is true (appended).
+ */
+template<typename Predicate>
+void filterSpans(const std::vector<Span>& spans, const Predicate& isInside, std::vector<Span>& filteredSpans)
+{
+  for (const auto& span : spans) {
+    int runStart = -1;
+    const int rowEnd = span.rowStart + span.length;
+    for (int row = span.rowStart; row < rowEnd; ++row) {
+      if (isInside(Index(row, span.column))) {
+        if (runStart < 0) runStart = row;
+      } else if (runStart >= 0) {
+        filteredSpans.emplace_back(span.column, runStart, row - runStart);
+        runStart = -1;
+      }
+    }
+    if (runStart >= 0) filteredSpans.emplace_back(span.column, runStart, rowEnd - runStart);
+  }
+}
+
+} /* namespace grid_map */
@@ -0,0 +1,94 @@
+/*
+ * ThreadPool.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+// STL
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace grid_map {
+
+/*!
+ * A pool of worker threads that runs batches of tasks. The threads are started once
+ * and wait between batches, such that short parallel loops over a map do not pay for
+ * thread creation. The calling thread takes part in each batch.
+ */
+class ThreadPool
+{
+ public:
+
+  /*!
+   * Constructor, starts the worker threads.
+   * @param nThreads the number of threads including the calling thread, 0 for the number of hardware threads.
+   */
+  explicit ThreadPool(const unsigned int nThreads = 0);
+
+  /*!
+   * Destructor, stops and joins the worker threads.
+   */
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  /*!
+   * Get the number of threads including the calling thread.
+   * @return the number of threads.
+   */
+  unsigned int getNumberOfThreads() const;
+
+  /*!
+   * Runs a batch of tasks and blocks until all of them are done. The tasks are handed
+   * out dynamically. Calls from within a task (of any pool) and calls while the pool is
+   * running a batch for another thread run the tasks on the calling thread.
+   * @param nTasks the number of tasks.
+   * @param function the task function, called as `function(task, thread)` with the
+   *                 thread in [0, getNumberOfThreads()), where the calling thread is 0.
+   *                 Tasks run concurrently, the function must not throw.
+   */
+  void run(const size_t nTasks, const std::function<void(size_t, unsigned int)>& function);
+
+  /*!
+   * Get the pool shared by the library, with the number of hardware threads.
+   * @return the global thread pool.
+   */
+  static ThreadPool& getGlobalPool();
+
+ private:
+
+  /*!
+   * Loop of a worker thread.
+   * @param thread the index of the worker thread (starting from 1).
+   */
+  void work(const unsigned int thread);
+
+  //! Worker threads.
+  std::vector<std::thread> threads_;
+
+  //! Serializes the batches.
+  std::mutex runMutex_;
+
+  //! Protects the batch state and signals start and end of a batch.
+  std::mutex mutex_;
+  std::condition_variable startCondition_;
+  std::condition_variable doneCondition_;
+
+  //! Current batch.
+  const std::function<void(size_t, unsigned int)>* function_;
+  size_t nTasks_;
+  std::atomic<size_t> nextTask_;
+  size_t generation_;
+  size_t nActiveWorkers_;
+  bool isStopping_;
+};
+
+} /* namespace grid_map */
@@ -32,4 +32,9 @@ namespace grid_map {
       // ToDo: INTER_CUBIC
   };
 
+  enum class BufferMode{
+      DEFAULT,     // buffer size given by the map length and resolution
+      POWER_OF_TWO // buffer size rounded up to powers of two (wrapping by bit masks)
+  };
+
 } /* namespace */
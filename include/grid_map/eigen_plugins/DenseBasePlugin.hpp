@@ -1,26 +1,28 @@
 Scalar numberOfFinites() const
 {
   if (SizeAtCompileTime==0 || (SizeAtCompileTime==Dynamic && size()==0)) return Scalar(0);
+  if (NumTraits<Scalar>::IsInteger) return Scalar(size());
   return Scalar((derived().array() == derived().array()).count());
 }
 
-Scalar sumOfFinites() const
+// Integers are summed up in (and returned as) 64 bit integers, such that sums of cost layers do not wrap.
+typename Eigen::internal::finites_sum_type<Scalar>::type sumOfFinites() const
 {
-  if (SizeAtCompileTime==0 || (SizeAtCompileTime==Dynamic && size()==0)) return Scalar(0);
-  return Scalar(this->redux(Eigen::internal::scalar_sum_of_finites_op<Scalar>()));
+  if (SizeAtCompileTime==0 || (SizeAtCompileTime==Dynamic && size()==0)) return 0;
+  return Eigen::internal::finites_redux_impl<Derived>::sum(derived());
 }
 
 Scalar meanOfFinites() const
 {
-  return Scalar(this->redux(Eigen::internal::scalar_sum_of_finites_op<Scalar>())) / this->numberOfFinites();
+  return Eigen::internal::finites_redux_impl<Derived>::mean(derived());
 }
 
 Scalar minCoeffOfFinites() const
 {
-  return Scalar(this->redux(Eigen::internal::scalar_min_of_finites_op<Scalar>()));
+  return Eigen::internal::finites_redux_impl<Derived>::minCoeff(derived());
 }
 
 Scalar maxCoeffOfFinites() const
 {
-  return Scalar(this->redux(Eigen::internal::scalar_max_of_finites_op<Scalar>()));
+  return Eigen::internal::finites_redux_impl<Derived>::maxCoeff(derived());
 }
@@ -1,5 +1,20 @@
 #include <math.h>
 
+// Packets of the reductions over finite values: float and double. Non-finite lanes are
+// replaced by the identity of the reduction (finite where x - x == 0).
+template<typename Scalar>
+struct has_finites_packet_op {
+  enum {
+    value = (is_same<Scalar, float>::value || is_same<Scalar, double>::value)
+        && packet_traits<Scalar>::Vectorizable
+  };
+};
+
+template<typename Packet>
+EIGEN_STRONG_INLINE Packet pfinite_or(const Packet& a, const Packet& otherwise) {
+  return pselect(pcmp_eq(psub(a, a), pzero(a)), a, otherwise);
+}
+
 template<typename Scalar> struct scalar_sum_of_finites_op {
   EIGEN_EMPTY_STRUCT_CTOR(scalar_sum_of_finites_op)
   EIGEN_STRONG_INLINE const Scalar operator() (const Scalar& a, const Scalar& b) const {
@@ -9,12 +24,21 @@ template<typename Scalar> struct scalar_sum_of_finites_op {
     if (isfinite(b)) return b;
     return a + b;
   }
+  // Lanes without finite values sum up to 0, see `finites_redux_impl`.
+  template<typename Packet>
+  EIGEN_STRONG_INLINE const Packet packetOp(const Packet& a, const Packet& b) const {
+    return padd(pfinite_or(a, pzero(a)), pfinite_or(b, pzero(b)));
+  }
+  template<typename Packet>
+  EIGEN_STRONG_INLINE const Scalar predux(const Packet& a) const {
+    return internal::predux(pfinite_or(a, pzero(a)));
+  }
 };
 template<typename Scalar>
 struct functor_traits<scalar_sum_of_finites_op<Scalar> > {
   enum {
     Cost = 2 * NumTraits<Scalar>::ReadCost + NumTraits<Scalar>::AddCost,
-    PacketAccess = false
+    PacketAccess = has_finites_packet_op<Scalar>::value
   };
 };
 
@@ -29,12 +53,22 @@ struct scalar_min_of_finites_op {
     if (isfinite(b)) return b;
     return (min)(a, b);
   }
+  // Lanes without finite values give +inf, see `finites_redux_impl`.
+  template<typename Packet>
+  EIGEN_STRONG_INLINE const Packet packetOp(const Packet& a, const Packet& b) const {
+    const Packet infinity = pset1<Packet>(NumTraits<Scalar>::infinity());
+    return pmin(pfinite_or(a, infinity), pfinite_or(b, infinity));
+  }
+  template<typename Packet>
+  EIGEN_STRONG_INLINE const Scalar predux(const Packet& a) const {
+    return predux_min(pfinite_or(a, pset1<Packet>(NumTraits<Scalar>::infinity())));
+  }
 };
 template<typename Scalar>
 struct functor_traits<scalar_min_of_finites_op<Scalar> > {
   enum {
     Cost = NumTraits<Scalar>::AddCost,
-    PacketAccess = false
+    PacketAccess = has_finites_packet_op<Scalar>::value && packet_traits<Scalar>::HasMin
   };
 };
 
@@ -49,11 +83,161 @@ struct scalar_max_of_finites_op {
     if (isfinite(b)) return b;
     return (max)(a, b);
   }
+  // Lanes without finite values give -inf, see `finites_redux_impl`.
+  template<typename Packet>
+  EIGEN_STRONG_INLINE const Packet packetOp(const Packet& a, const Packet& b) const {
+    const Packet infinity = pset1<Packet>(-NumTraits<Scalar>::infinity());
+    return pmax(pfinite_or(a, infinity), pfinite_or(b, infinity));
+  }
+  template<typename Packet>
+  EIGEN_STRONG_INLINE const Scalar predux(const Packet& a) const {
+    return predux_max(pfinite_or(a, pset1<Packet>(-NumTraits<Scalar>::infinity())));
+  }
 };
 template<typename Scalar>
 struct functor_traits<scalar_max_of_finites_op<Scalar> > {
   enum {
     Cost = NumTraits<Scalar>::AddCost,
-    PacketAccess = false
+    PacketAccess = has_finites_packet_op<Scalar>::value && packet_traits<Scalar>::HasMax
   };
 };
+
+// Reductions over finite values, used by the DenseBase plugin. The packet functors cannot
+// tell an empty set of finite values from a result that equals the identity, in that case
+// the result of the scalar functors (the reduction over the non-finite values) is restored.
+// Type of the sums over finite values, 64 bit integers for integers.
+template<typename Scalar, bool IsInteger = NumTraits<Scalar>::IsInteger>
+struct finites_sum_type {
+  typedef Scalar type;
+};
+template<typename Scalar>
+struct finites_sum_type<Scalar, true> {
+  typedef typename conditional<NumTraits<Scalar>::IsSigned, int64_t, uint64_t>::type type;
+};
+
+template<typename Derived, bool IsInteger = NumTraits<typename Derived::Scalar>::IsInteger>
+struct finites_redux_impl {
+  typedef typename Derived::Scalar Scalar;
+
+  static Scalar sum(const Derived& x) {
+    const Scalar result = x.redux(scalar_sum_of_finites_op<Scalar>());
+    if (functor_traits<scalar_sum_of_finites_op<Scalar> >::PacketAccess && result == Scalar(0)
+        && !(std::isfinite)(maxCoeff(x))) return x.sum();
+    return result;
+  }
+
+  static Scalar mean(const Derived& x) {
+    return sum(x) / Scalar((x.array() == x.array()).count());
+  }
+
+  static Scalar minCoeff(const Derived& x) {
+    const Scalar result = x.redux(scalar_min_of_finites_op<Scalar>());
+    if (functor_traits<scalar_min_of_finites_op<Scalar> >::PacketAccess && !(std::isfinite)(result)) {
+      return x.minCoeff();
+    }
+    return result;
+  }
+
+  static Scalar maxCoeff(const Derived& x) {
+    const Scalar result = x.redux(scalar_max_of_finites_op<Scalar>());
+    if (functor_traits<scalar_max_of_finites_op<Scalar> >::PacketAccess && !(std::isfinite)(result)) {
+      return x.maxCoeff();
+    }
+    return result;
+  }
+};
+
+// Sum of contiguous integers in a wider integer, in blocks of 32 bits for small integers
+// (which the compiler vectorizes) and the blocks in 64 bits.
+template<typename Scalar, typename Wide, typename Block>
+EIGEN_STRONG_INLINE Wide wide_sum_of_contiguous(const Scalar* data, const Index size, const Wide*, const Block*) {
+  const Index blockSize = sizeof(Scalar) <= 2 ? Index(1) << 15 : size;
+  Wide result = 0;
+  for (Index begin = 0; begin < size; begin += blockSize) {
+    const Index end = (std::min)(size, begin + blockSize);
+    Block block = 0;
+    for (Index i = begin; i < end; ++i) block += data[i];
+    result += block;
+  }
+  return result;
+}
+
+#ifdef EIGEN_VECTORIZE_SSE2
+// Bytes are summed up 16 at once into two 64 bit lanes by the sum of absolute differences to 0.
+template<typename Block>
+EIGEN_STRONG_INLINE uint64_t wide_sum_of_contiguous(const unsigned char* data, const Index size, const uint64_t*, const Block*) {
+  const __m128i zero = _mm_setzero_si128();
+  __m128i sums = zero;
+  Index i = 0;
+  for (; i + 16 <= size; i += 16) {
+    sums = _mm_add_epi64(sums, _mm_sad_epu8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)), zero));
+  }
+  uint64_t lanes[2];
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), sums);
+  uint64_t result = lanes[0] + lanes[1];
+  for (; i < size; ++i) result += data[i];
+  return result;
+}
+#endif
+
+// Integers are always finite. Sums are accumulated in (and returned as) 64 bit integers,
+// over the inner vectors with direct access or over the coefficients otherwise.
+template<typename Derived>
+struct finites_redux_impl<Derived, true> {
+  typedef typename Derived::Scalar Scalar;
+  typedef typename finites_sum_type<Scalar>::type Wide;
+  typedef typename conditional<(sizeof(Scalar) <= 2),
+      typename conditional<NumTraits<Scalar>::IsSigned, int32_t, uint32_t>::type, Wide>::type Block;
+  typedef typename nested_eval<Derived, 1>::type Nested;
+  typedef typename remove_all<Nested>::type NestedCleaned;
+  enum { HasDirectAccess = (int(traits<NestedCleaned>::Flags) & DirectAccessBit) != 0 };
+
+  template<typename Evaluated>
+  static Wide wideSum(const Evaluated& x, true_type) {
+    if (x.innerStride() != 1) return coefficientSum(x);
+    Wide result = 0;
+    for (Index j = 0; j < x.outerSize(); ++j) {
+      result += wide_sum_of_contiguous(x.data() + j * x.outerStride(), x.innerSize(), (const Wide*)0, (const Block*)0);
+    }
+    return result;
+  }
+
+  template<typename Evaluated>
+  static Wide wideSum(const Evaluated& x, false_type) {
+    return coefficientSum(x);
+  }
+
+  template<typename Evaluated>
+  static Wide coefficientSum(const Evaluated& x) {
+    Wide result = 0;
+    for (Index j = 0; j < x.cols(); ++j) {
+      Block block = 0;
+      for (Index i = 0; i < x.rows(); ++i) {
+        block += x.coeff(i, j);
+        if (sizeof(Scalar) <= 2 && (i & 0x7fff) == 0x7fff) {
+          result += block;
+          block = 0;
+        }
+      }
+      result += block;
+    }
+    return result;
+  }
+
+  static Wide sum(const Derived& x) {
+    Nested evaluated(x);
+    return wideSum(evaluated, typename conditional<bool(HasDirectAccess), true_type, false_type>::type());
+  }
+
+  static Scalar mean(const Derived& x) {
+    if (x.size() == 0) return Scalar(0);
+    return Scalar(double(sum(x)) / double(x.size()));
+  }
+  static Scalar minCoeff(const Derived& x) {
+    return x.minCoeff();
+  }
+
+  static Scalar maxCoeff(const Derived& x) {
+    return x.maxCoeff();
+  }
+};
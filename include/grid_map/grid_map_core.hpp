@@ -10,9 +10,22 @@
 
 #include "grid_map/TypeDefs.hpp"
 #include "grid_map/GridMap.hpp"
+#include "grid_map/GridIndexer.hpp"
+#include "grid_map/LayerAccessor.hpp"
 #include "grid_map/SubmapGeometry.hpp"
 #include "grid_map/GridMapMath.hpp"
 #include "grid_map/BufferRegion.hpp"
+#include "grid_map/Span.hpp"
 #include "grid_map/Polygon.hpp"
+#include "grid_map/PolygonRasterizer.hpp"
+#include "grid_map/PolygonIndex.hpp"
+#include "grid_map/Parallel.hpp"
+#include "grid_map/ThreadPool.hpp"
+#include "grid_map/ParallelForEach.hpp"
+#include "grid_map/RayCaster.hpp"
+#include "grid_map/RayTemplateCache.hpp"
+#include "grid_map/SlidingWindowFilter.hpp"
+#include "grid_map/RingOffsetTable.hpp"
+#include "grid_map/NearestCellSearch.hpp"
 #include "grid_map/iterators/iterators.hpp"
 #include "grid_map/eigen_plugins/Functors.hpp"
@@ -9,16 +9,21 @@
 #pragma once
 
 #include "grid_map/GridMap.hpp"
-#include "grid_map/iterators/SubmapIterator.hpp"
+#include "grid_map/Span.hpp"
 
 #include <Eigen/Core>
 
-#include <memory>
+#include <vector>
 
 namespace grid_map {
 
 /*!
  * Iterator class to iterate through a circular area of the map.
+ * The cells inside the circle are computed analytically per row (and per column
+ * for `getSpans(...)`), such that only cells inside the circle are visited.
+ * The iterator is a small value type without heap allocations. It keeps a copy of
+ * the geometry of the map (see `GridMap::getIndexer()`) from its construction, such
+ * that a later move of the map does not change the iterated cells.
  */
 class CircleIterator
 {
@@ -37,7 +42,7 @@ public:
    * @param iterator the iterator to copy data from.
    * @return a reference to *this.
    */
-  CircleIterator& operator =(const CircleIterator& other);
+  CircleIterator& operator =(const CircleIterator& other) = default;
 
   /*!
    * Compare to another iterator.
@@ -63,13 +68,45 @@ public:
    */
   bool isPastEnd() const;
 
+  /*!
+   * Get the cells covered by the iterator as spans (contiguous runs of cells per
+   * column of the buffer), independent of the current state of the iterator.
+   * @param[out] spans the spans covering the region of the iterator.
+   */
+  void getSpans(std::vector<Span>& spans) const;
+
 private:
 
   /*!
-   * Check if current index is inside the circle.
+   * Check if a cell is inside the circle.
+   * @param index the unwrapped index of the cell.
    * @return true if inside, false otherwise.
    */
-  bool isInside() const;
+  bool isInside(const Index& index) const;
+
+  /*!
+   * Computes the cells of a row that are inside the circle.
+   * @param[in] row the unwrapped row.
+   * @param[out] begin the first unwrapped column inside the circle.
+   * @param[out] end the end (past the last unwrapped column) of the interval.
+   * @return true if the row has cells inside the circle.
+   */
+  bool getRowInterval(const int row, int& begin, int& end) const;
+
+  /*!
+   * Computes the cells of a column that are inside the circle.
+   * @param[in] column the unwrapped column.
+   * @param[out] begin the first unwrapped row inside the circle.
+   * @param[out] end the end (past the last unwrapped row) of the interval.
+   * @return true if the column has cells inside the circle.
+   */
+  bool getColumnInterval(const int column, int& begin, int& end) const;
+
+  /*!
+   * Moves the iterator to the first cell inside the circle, starting from a row.
+   * @param row the unwrapped row to start from.
+   */
+  void findNextRow(int row);
 
   /*!
    * Finds the submap that fully contains the circle and returns the parameters.
@@ -90,15 +127,23 @@ private:
   //! Square of the radius (for efficiency).
   double radiusSquare_;
 
-  //! Grid submap iterator. // TODO Think of using unique_ptr instead.
-  std::shared_ptr<SubmapIterator> internalIterator_;
+  //! Geometry of the map at construction.
+  GridIndexer indexer_;
+
+  //! Unwrapped start index and size of the submap containing the circle.
+  Index submapStartIndex_;
+  Size submapSize_;
+
+  //! Current unwrapped row and column, and end of the current row interval.
+  int row_;
+  int column_;
+  int columnEnd_;
+
+  //! Current (buffer) index.
+  Index index_;
 
-  //! Map information needed to get position from iterator.
-  Length mapLength_;
-  Position mapPosition_;
-  double resolution_;
-  Size bufferSize_;
-  Index bufferStartIndex_;
+  //! Is iterator out of scope.
+  bool isPastEnd_;
 
  public:
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
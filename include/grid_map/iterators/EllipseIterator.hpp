@@ -9,17 +9,22 @@
 #pragma once
 
 #include "grid_map/GridMap.hpp"
-#include "grid_map/iterators/SubmapIterator.hpp"
+#include "grid_map/Span.hpp"
 
 #include <Eigen/Core>
 
-#include <memory>
+#include <vector>
 
 namespace grid_map {
 
 /*!
  * Iterator class to iterate through a ellipsoid area of the map.
  * The main axis of the ellipse are aligned with the map frame.
+ * The cells inside the ellipse are computed analytically per row (and per column
+ * for `getSpans(...)`), such that only cells inside the ellipse are visited.
+ * The iterator is a small value type without heap allocations. It keeps a copy of
+ * the geometry of the map (see `GridMap::getIndexer()`) from its construction, such
+ * that a later move of the map does not change the iterated cells.
  */
 class EllipseIterator
 {
@@ -39,7 +44,7 @@ public:
    * @param iterator the iterator to copy data from.
    * @return a reference to *this.
    */
-  EllipseIterator& operator =(const EllipseIterator& other);
+  EllipseIterator& operator =(const EllipseIterator& other) = default;
 
   /*!
    * Compare to another iterator.
@@ -65,6 +70,13 @@ public:
    */
   bool isPastEnd() const;
 
+  /*!
+   * Get the cells covered by the iterator as spans (contiguous runs of cells per
+   * column of the buffer), independent of the current state of the iterator.
+   * @param[out] spans the spans covering the region of the iterator.
+   */
+  void getSpans(std::vector<Span>& spans) const;
+
   /*!
    * Returns the size of the submap covered by the iterator.
    * @return the size of the submap covered by the iterator.
@@ -74,10 +86,27 @@ public:
 private:
 
   /*!
-   * Check if current index is inside the ellipse.
+   * Check if a cell is inside the ellipse.
+   * @param index the unwrapped index of the cell.
    * @return true if inside, false otherwise.
    */
-  bool isInside() const;
+  bool isInside(const Index& index) const;
+
+  /*!
+   * Computes the cells of a row or column that are inside the ellipse.
+   * @param[in] dimension 0 for a row (fixed x), 1 for a column (fixed y).
+   * @param[in] line the unwrapped row or column.
+   * @param[out] begin the first unwrapped column/row inside the ellipse.
+   * @param[out] end the end (past the last unwrapped column/row) of the interval.
+   * @return true if the row/column has cells inside the ellipse.
+   */
+  bool getInterval(const int dimension, const int line, int& begin, int& end) const;
+
+  /*!
+   * Moves the iterator to the first cell inside the ellipse, starting from a row.
+   * @param row the unwrapped row to start from.
+   */
+  void findNextRow(int row);
 
   /*!
    * Finds the submap that fully contains the ellipse and returns the parameters.
@@ -99,15 +128,27 @@ private:
   //! Sine and cosine values of the rotation angle as transformation matrix.
   Eigen::Matrix2d transformMatrix_;
 
-  //! Grid submap iterator. // TODO Think of using unique_ptr instead.
-  std::shared_ptr<SubmapIterator> internalIterator_;
+  //! Coefficients of the ellipse equation as quadratic form d^T * Q * d <= 1 of the
+  //! offset d to the center.
+  Eigen::Matrix2d quadraticForm_;
+
+  //! Geometry of the map at construction.
+  GridIndexer indexer_;
+
+  //! Unwrapped start index and size of the submap containing the ellipse.
+  Index submapStartIndex_;
+  Size submapSize_;
+
+  //! Current unwrapped row and column, and end of the current row interval.
+  int row_;
+  int column_;
+  int columnEnd_;
+
+  //! Current (buffer) index.
+  Index index_;
 
-  //! Map information needed to get position from iterator.
-  Length mapLength_;
-  Position mapPosition_;
-  double resolution_;
-  Size bufferSize_;
-  Index bufferStartIndex_;
+  //! Is iterator out of scope.
+  bool isPastEnd_;
 
  public:
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
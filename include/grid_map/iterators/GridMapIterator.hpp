@@ -9,6 +9,7 @@
 #pragma once
 
 #include "grid_map/GridMap.hpp"
+#include "grid_map/Span.hpp"
 
 // Eigen
 #include <Eigen/Core>
@@ -86,6 +87,13 @@ public:
    */
   bool isPastEnd() const;
 
+  /*!
+   * Get the cells covered by the iterator as spans (contiguous runs of cells per
+   * column of the buffer), independent of the current state of the iterator.
+   * @param[out] spans the spans covering the region of the iterator.
+   */
+  void getSpans(std::vector<Span>& spans) const;
+
 protected:
 
   //! Size of the buffer.
@@ -97,6 +105,10 @@ protected:
   //! Linear size of the data.
   size_t linearSize_;
 
+  //! Shift for linear to 2d index conversions if the number of rows is a power of two,
+  //! -1 otherwise.
+  int rowShift_;
+
   //! Linear index.
   size_t linearIndex_;
 
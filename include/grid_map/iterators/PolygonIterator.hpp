@@ -10,19 +10,34 @@
 
 #include "grid_map/GridMap.hpp"
 #include "grid_map/Polygon.hpp"
-#include "grid_map/iterators/SubmapIterator.hpp"
+#include "grid_map/PolygonRasterizer.hpp"
+#include "grid_map/Span.hpp"
 
-#include <memory>
+#include <array>
+#include <vector>
 
 namespace grid_map {
 
 /*!
  * Iterator class to iterate through a polygonal area of the map.
+ * The cells inside the polygon are computed lazily row by row, such that only cells
+ * inside the polygon are visited: along a row, the cells for which an edge counts as
+ * crossing in `Polygon::isInside(...)` form an interval, and the cells inside the
+ * polygon are the ones covered by an odd number of these intervals.
+ *
+ * The iterator is a small value type without heap allocations (for polygons with up
+ * to `nInlineVertices` vertices). It keeps copies of the vertices of the polygon and
+ * of the geometry of the map (see `GridMap::getIndexer()`) from its construction, such
+ * that neither has to outlive it and a later move of the map does not change the
+ * iterated cells.
  */
 class PolygonIterator
 {
 public:
 
+  //! Maximal number of vertices of polygons that are copied and iterated without heap allocation.
+  constexpr static unsigned int nInlineVertices = 16;
+
   /*!
    * Constructor.
    * @param gridMap the grid map to iterate on.
@@ -35,7 +50,7 @@ public:
    * @param iterator the iterator to copy data from.
    * @return a reference to *this.
    */
-  PolygonIterator& operator =(const PolygonIterator& other);
+  PolygonIterator& operator =(const PolygonIterator& other) = default;
 
   /*!
    * Compare to another iterator.
@@ -61,34 +76,89 @@ public:
    */
   bool isPastEnd() const;
 
+  /*!
+   * Get the cells covered by the iterator as spans (contiguous runs of cells per
+   * column of the buffer), independent of the current state of the iterator.
+   * @param[out] spans the spans covering the region of the iterator.
+   */
+  void getSpans(std::vector<Span>& spans) const;
+
 private:
 
   /*!
-   * Check if current index is inside polygon.
-   * @return true if inside, false otherwise.
+   * Check if an edge counts as crossing for a cell (same expression as `Polygon::isInside(...)`).
+   * @param edge the edge from vertex `edge` to the previous vertex.
+   * @param row the unwrapped row of the cell.
+   * @param column the unwrapped column of the cell.
+   * @return true if the edge counts as crossing.
+   */
+  bool isCrossing(const size_t edge, const int row, const int column) const;
+
+  /*!
+   * Computes the cells of a row for which an edge counts as crossing.
+   * @param[in] edge the edge from vertex `edge` to the previous vertex.
+   * @param[in] row the unwrapped row.
+   * @param[out] begin the first unwrapped column of the interval.
+   * @param[out] end the end (past the last unwrapped column) of the interval.
+   * @return true if the interval is not empty.
    */
-  bool isInside() const;
+  bool getCrossingInterval(const size_t edge, const int row, int& begin, int& end) const;
 
   /*!
-   * Finds the submap that fully contains the polygon and returns the parameters.
-   * @param[in] polygon the polygon to get the submap for.
-   * @param[out] startIndex the start index of the submap.
-   * @param[out] bufferSize the buffer size of the submap.
+   * Moves the iterator to the first cell inside the polygon, starting from a row.
+   * @param row the unwrapped row to start from.
    */
-  void findSubmapParameters(const grid_map::Polygon& polygon, Index& startIndex,Size& bufferSize) const;
+  void findNextRow(int row);
 
-  //! Polygon to iterate on.
-  grid_map::Polygon polygon_;
+  /*!
+   * Moves the iterator to the next run of inside cells of the current row.
+   * @return true if the row has a next run, false otherwise.
+   */
+  bool findNextRun();
 
-  //! Grid submap iterator.
-  std::shared_ptr<SubmapIterator> internalIterator_;
+  /*!
+   * Get the copied vertices of the polygon.
+   * @return the pointer to the first vertex.
+   */
+  const Position* getVertices() const;
 
-  //! Map information needed to get position from iterator.
-  Length mapLength_;
-  Position mapPosition_;
-  double resolution_;
-  Size bufferSize_;
-  Index bufferStartIndex_;
+  /*!
+   * Get the storage for the ends of the crossing intervals of a row.
+   * @return the pointer to the storage.
+   */
+  int* getToggles();
+
+  //! Vertices of the polygon to iterate on. The vector is only used for polygons with
+  //! more than `nInlineVertices` vertices.
+  std::array<Position, nInlineVertices> inlineVertices_;
+  std::vector<Position> vertices_;
+  size_t nVertices_;
+
+  //! Geometry of the map at construction.
+  GridIndexer indexer_;
+
+  //! Unwrapped start index and size of the submap containing the polygon.
+  Index submapStartIndex_;
+  Size submapSize_;
+
+  //! Sorted ends of the crossing intervals of the current row (the parity of the
+  //! number of crossings toggles at each end). The vector is only used for polygons
+  //! with more than `nInlineVertices` vertices.
+  std::array<int, 2 * nInlineVertices> inlineToggles_;
+  std::vector<int> toggles_;
+  int nToggles_;
+  int toggleIndex_;
+
+  //! Current unwrapped row and column, and end of the current run.
+  int row_;
+  int column_;
+  int columnEnd_;
+
+  //! Current (buffer) index.
+  Index index_;
+
+  //! Is iterator out of scope.
+  bool isPastEnd_;
 
  public:
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
@@ -19,7 +19,8 @@ namespace grid_map {
 /*!
  * Iterator class to iterate trough the entire grid map with access to a layer's
  * data through a sliding window.
- * Note: This iterator only works with maps with zero start index.
+ * For maps with a circular buffer offset, the window follows the unwrapped indices
+ * and is gathered across the seams of the buffer.
  */
 class SlidingWindowIterator : public GridMapIterator
 {
@@ -70,11 +71,19 @@ public:
 
 private:
   //! Setup members.
-  void setup(const GridMap& gridMap);
+  void setup();
 
   //! Check if data for current index is fully inside map.
   bool dataInsideMap() const;
 
+  /*!
+   * Copies a block of the data, split into buffer regions at the seams of the buffer.
+   * @param topLeftIndex the unwrapped index of the top left cell of the block.
+   * @param size the size of the block.
+   * @return the data of the block.
+   */
+  Matrix getBlock(const Index& topLeftIndex, const Size& size) const;
+
   //! Edge handling method.
   const EdgeHandling edgeHandling_;
 
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "grid_map/GridMap.hpp"
+#include "grid_map/RingOffsetTable.hpp"
 
 #include <Eigen/Core>
 #include <memory>
@@ -18,6 +19,7 @@ namespace grid_map {
 
 /*!
  * Iterator class to iterate through a circular area of the map with a spiral.
+ * The rings of the spiral are taken from the shared `RingOffsetTable`.
  */
 class SpiralIterator
 {
@@ -77,14 +79,10 @@ private:
   bool isInside(const Index index) const;
 
   /*!
-   * Uses the current distance to get the points of a ring
-   * around the center.
+   * Moves the iterator to the next cell of the spiral that is within the map
+   * and the circle, starting before the current position in the current ring.
    */
-  void generateRing();
-
-  int signum(const int val) {
-      return (0 < val) - (val < 0);
-  }
+  void findNextCell();
 
   //! Position of the circle center;
   Position center_;
@@ -100,7 +98,16 @@ private:
   //! Number of rings into the circle is divided.
   unsigned int nRings_;
   unsigned int distance_;
-  std::vector<Index> pointsRing_;
+
+  //! Shared ring offsets and position of the current cell in the current ring.
+  std::shared_ptr<const RingOffsetTable> rings_;
+  size_t ringPosition_;
+
+  //! Current index.
+  Index index_;
+
+  //! Is iterator out of scope.
+  bool isPastEnd_;
 
   //! Map information needed to get position from iterator.
   Length mapLength_;
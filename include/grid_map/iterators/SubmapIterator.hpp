@@ -11,6 +11,7 @@
 #include "grid_map/GridMap.hpp"
 #include "grid_map/SubmapGeometry.hpp"
 #include "grid_map/BufferRegion.hpp"
+#include "grid_map/Span.hpp"
 
 #include <Eigen/Core>
 
@@ -95,6 +96,19 @@ public:
    */
   const Size& getSubmapSize() const;
 
+  /*!
+   * Returns the (top-left) start index of the submap covered by the iterator.
+   * @return the start index of the submap.
+   */
+  const Index& getSubmapStartIndex() const;
+
+  /*!
+   * Get the cells covered by the iterator as spans (contiguous runs of cells per
+   * column of the buffer), independent of the current state of the iterator.
+   * @param[out] spans the spans covering the region of the iterator.
+   */
+  void getSpans(std::vector<Span>& spans) const;
+
 private:
 
   //! Size of the buffer.
@@ -0,0 +1,202 @@
+/**
+ * @file /cost_map_core/include/cost_map_core/operators/CostStatistics.hpp
+ */
+/*****************************************************************************
+** Ifdefs
+*****************************************************************************/
+
+#ifndef cost_map_core_COST_STATISTICS_HPP_
+#define cost_map_core_COST_STATISTICS_HPP_
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include "../grid_map_core.hpp"
+#include "Inflation.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace grid_map {
+
+/*****************************************************************************
+** Cost Statistics
+*****************************************************************************/
+
+/**
+ * @brief Statistics of the known cells of a cost layer region.
+ *
+ * Statistics of several regions (e.g. tiles) can be merged with +=.
+ */
+struct CostStatistics {
+  CostStatistics();
+
+  /**
+   * @brief Merge the statistics of another region.
+   */
+  CostStatistics& operator+=(const CostStatistics& other);
+
+  /**
+   * @brief Mean cost of the known cells (0 if there are none).
+   */
+  double mean() const;
+
+  /**
+   * @brief Fraction of the known cells that are lethal (0 if there are none).
+   */
+  double lethalFraction() const;
+
+  size_t number_of_known;    // cells not equal to the unknown cost
+  size_t number_of_unknown;  // cells equal to the unknown cost
+  size_t number_of_lethal;   // known cells at or above the lethal cost
+  uint64_t sum;              // sum of the known costs
+  unsigned char min, max;    // range of the known costs (255 and 0 if there are none)
+};
+
+/**
+ * @brief Number of cells per cost value, including the unknown cost.
+ */
+typedef std::array<size_t, 256> CostHistogram;
+
+/**
+ * @brief Computes statistics of cost layers, treating a sentinel cost as missing.
+ *
+ * Regions are whole layers, buffer regions, submaps or spans (e.g. of a shape
+ * iterator, see Span). Each column of a region is contiguous in memory and reduced
+ * in one pass, 16 cells at once with SSE2 where available. Histograms are counted
+ * into interleaved sub-histograms to break the dependency between equal costs.
+ */
+class CostStatisticsComputer {
+public:
+  /**
+   * @brief Configure the sentinel and the lethal cost.
+   *
+   * @param unknown_cost the cost of cells without information
+   * @param lethal_cost known costs at or above this are lethal
+   */
+  CostStatisticsComputer(const unsigned char& unknown_cost = NO_INFORMATION,
+                         const unsigned char& lethal_cost = LETHAL_OBSTACLE);
+
+  /**
+   * @brief Statistics of a whole layer.
+   *
+   * @param data the cost layer
+   * @return the statistics
+   */
+  CostStatistics operator()(const grid_map::Matrix& data) const;
+
+  /**
+   * @brief Statistics of a region of the buffer.
+   *
+   * @param data the cost layer
+   * @param region the region in buffer indices (must not cross the wrap of the buffer)
+   * @return the statistics
+   */
+  CostStatistics operator()(const grid_map::Matrix& data, const BufferRegion& region) const;
+
+  /**
+   * @brief Statistics of the cells of spans.
+   *
+   * @param data the cost layer
+   * @param spans the spans in buffer indices
+   * @return the statistics
+   */
+  CostStatistics operator()(const grid_map::Matrix& data, const std::vector<Span>& spans) const;
+
+  /**
+   * @brief Statistics of a submap, which may cross the wrap of the buffer.
+   *
+   * @param layer the cost layer
+   * @param start_index the buffer index of the top left cell of the submap
+   * @param size the size of the submap
+   * @param cost_map the cost map
+   * @return the statistics
+   * @throw std::out_of_range if no map layer with name `layer` is present or the submap is not inside the map.
+   */
+  CostStatistics operator()(const std::string& layer,
+                            const Index& start_index,
+                            const Size& size,
+                            const GridMap& cost_map) const;
+
+  /**
+   * @brief Histogram of a whole layer.
+   *
+   * @param data the cost layer
+   * @param histogram the number of cells per cost
+   */
+  void histogram(const grid_map::Matrix& data, CostHistogram& histogram) const;
+
+  /**
+   * @brief Histogram of a region of the buffer.
+   *
+   * @param data the cost layer
+   * @param region the region in buffer indices (must not cross the wrap of the buffer)
+   * @param histogram the number of cells per cost
+   */
+  void histogram(const grid_map::Matrix& data, const BufferRegion& region, CostHistogram& histogram) const;
+
+  /**
+   * @brief Histogram of the cells of spans.
+   *
+   * @param data the cost layer
+   * @param spans the spans in buffer indices
+   * @param histogram the number of cells per cost
+   */
+  void histogram(const grid_map::Matrix& data, const std::vector<Span>& spans, CostHistogram& histogram) const;
+
+  /**
+   * @brief Histogram of a submap, which may cross the wrap of the buffer.
+   *
+   * @param layer the cost layer
+   * @param start_index the buffer index of the top left cell of the submap
+   * @param size the size of the submap
+   * @param cost_map the cost map
+   * @param histogram the number of cells per cost
+   * @throw std::out_of_range if no map layer with name `layer` is present or the submap is not inside the map.
+   */
+  void histogram(const std::string& layer,
+                 const Index& start_index,
+                 const Size& size,
+                 const GridMap& cost_map,
+                 CostHistogram& histogram) const;
+
+private:
+  /**
+   * @brief Accumulate the statistics of contiguous cells.
+   */
+  void accumulate(const unsigned char* data, const size_t& size, CostStatistics& statistics) const;
+
+  /**
+   * @brief Count the costs of contiguous cells into four interleaved sub-histograms.
+   *
+   * @param counts the 4 x 256 counts, allocated once per histogram
+   */
+  static void accumulate(const unsigned char* data, const size_t& size, std::vector<uint32_t>& counts);
+
+  /**
+   * @brief Sum up the sub-histograms of `accumulate(...)` into a histogram.
+   */
+  static void merge(const std::vector<uint32_t>& counts, CostHistogram& histogram);
+
+  /**
+   * @brief The spans of a submap.
+   */
+  static std::vector<Span> getSubmapSpans(const Index& start_index, const Size& size, const GridMap& cost_map);
+
+  unsigned char unknown_cost_, lethal_cost_;
+};
+
+/*****************************************************************************
+** Trailers
+*****************************************************************************/
+
+} // namespace grid_map
+
+#endif /* cost_map_core_COST_STATISTICS_HPP_ */
@@ -0,0 +1,105 @@
+/**
+ * @file /cost_map_core/include/cost_map_core/operators/FillPolygons.hpp
+ */
+/*****************************************************************************
+** Ifdefs
+*****************************************************************************/
+
+#ifndef cost_map_core_FILL_POLYGONS_HPP_
+#define cost_map_core_FILL_POLYGONS_HPP_
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include "../grid_map_core.hpp"
+#include <string>
+#include <vector>
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace grid_map {
+
+/*****************************************************************************
+** Fill Polygons
+*****************************************************************************/
+
+/**
+ * @brief How the value of a polygon is combined with the value of a cell.
+ */
+enum class PolygonFillMode {
+  OVERWRITE, // later polygons overwrite earlier ones and the layer
+  MAXIMUM,   // maximum of the layer and all polygons covering the cell
+  MINIMUM    // minimum of the layer and all polygons covering the cell
+};
+
+/**
+ * @brief Functor to rasterize many polygons with per polygon values into a layer.
+ *
+ * The polygons are rasterized into spans per column (see PolygonRasterizer) in
+ * parallel, one polygon per task. Polygons crossing the map border are not clipped,
+ * only the spans inside the map are produced. The spans are then sorted into tiles
+ * of columns, and the tiles are filled in parallel. Within a tile the polygons are
+ * applied in the order given, such that OVERWRITE gives the same result as filling
+ * the polygons one after the other. The cells are the cells of a PolygonIterator.
+ */
+class FillPolygons {
+public:
+  /**
+   * @brief Configure the combine rule and the tiles.
+   *
+   * @param mode how the polygon values are combined with the layer
+   * @param tile_width the number of columns of the buffer per tile
+   */
+  FillPolygons(const PolygonFillMode& mode = PolygonFillMode::MAXIMUM,
+               const unsigned int& tile_width = 32);
+
+  /**
+   * @brief Rasterize the polygons into a layer.
+   *
+   * @param layer the layer to fill
+   * @param polygons the polygons
+   * @param values the value per polygon
+   * @param cost_map the cost map
+   * @param thread_pool the threads to rasterize and fill on
+   * @throw std::out_of_range if no map layer with name `layer` is present.
+   * @throw std::invalid_argument if the number of values does not match the number of polygons.
+   */
+  void operator()(const std::string& layer,
+                  const std::vector<Polygon>& polygons,
+                  const std::vector<unsigned char>& values,
+                  GridMap& cost_map,
+                  ThreadPool& thread_pool = ThreadPool::getGlobalPool()
+                 );
+
+  /**
+   * @brief Rasterize the polygons into a layer, all with the same value.
+   *
+   * @param layer the layer to fill
+   * @param polygons the polygons
+   * @param value the value of all polygons
+   * @param cost_map the cost map
+   * @param thread_pool the threads to rasterize and fill on
+   * @throw std::out_of_range if no map layer with name `layer` is present.
+   */
+  void operator()(const std::string& layer,
+                  const std::vector<Polygon>& polygons,
+                  const unsigned char& value,
+                  GridMap& cost_map,
+                  ThreadPool& thread_pool = ThreadPool::getGlobalPool()
+                 );
+
+private:
+  PolygonFillMode mode_;
+  unsigned int tile_width_;
+};
+
+/*****************************************************************************
+** Trailers
+*****************************************************************************/
+
+} // namespace grid_map
+
+#endif /* cost_map_core_FILL_POLYGONS_HPP_ */
@@ -0,0 +1,187 @@
+/**
+ * @file /cost_map_core/include/cost_map_core/operators/FootprintChecker.hpp
+ */
+/*****************************************************************************
+** Ifdefs
+*****************************************************************************/
+
+#ifndef cost_map_core_FOOTPRINT_CHECKER_HPP_
+#define cost_map_core_FOOTPRINT_CHECKER_HPP_
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include "../grid_map_core.hpp"
+#include "Inflation.hpp"
+#include <Eigen/Core>
+#include <string>
+#include <vector>
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace grid_map {
+
+/*****************************************************************************
+** Footprint Checker
+*****************************************************************************/
+
+/**
+ * @brief Collision checks of a robot footprint against a cost layer.
+ *
+ * The footprint is rasterized upfront for a number of discrete headings at the
+ * resolution of the map, as runs of cells per column relative to the cell of the
+ * robot position. A check then only reads these runs from the cost layer (they are
+ * contiguous in memory) and stops at the first lethal cost.
+ *
+ * The robot position is snapped to the center of its cell and the heading to the
+ * closest discrete heading, i.e. the cells are exactly the cells of a PolygonIterator
+ * over the footprint at the snapped pose.
+ */
+class FootprintChecker {
+public:
+  /**
+   * @brief Configure the footprint, the tables are built on the first check.
+   *
+   * @param footprint the footprint polygon in the robot frame
+   * @param number_of_headings the number of discrete headings over the full circle
+   */
+  FootprintChecker(const Polygon& footprint, const unsigned int& number_of_headings = 64);
+
+  /**
+   * @brief Rebuild the footprint tables if the resolution changed.
+   *
+   * @param resolution the resolution of the cost map
+   * @return true if the tables were rebuilt
+   */
+  bool update(const double& resolution);
+
+  /**
+   * @brief Set the cost at which a check stops early (default LETHAL_OBSTACLE).
+   *
+   * @param lethal_cost costs greater or equal to this are in collision
+   */
+  void setLethalCost(const unsigned char& lethal_cost);
+
+  /**
+   * @brief Set the cost of footprint cells outside of the map (default NO_INFORMATION).
+   *
+   * @param outside_cost the cost of cells outside of the map
+   */
+  void setOutsideCost(const unsigned char& outside_cost);
+
+  /**
+   * @brief Maximum cost under the footprint at a pose.
+   *
+   * @param layer the cost layer
+   * @param position the position of the robot
+   * @param heading the heading of the robot (in [rad])
+   * @param cost_map the cost map
+   * @return the maximum cost, or the first cost found at or above the lethal cost
+   * @throw std::out_of_range if no map layer with name `layer` is present.
+   */
+  unsigned char getCost(const std::string& layer,
+                        const Position& position,
+                        const double& heading,
+                        const GridMap& cost_map);
+
+  /**
+   * @brief Check if the footprint at a pose is in collision.
+   *
+   * @param layer the cost layer
+   * @param position the position of the robot
+   * @param heading the heading of the robot (in [rad])
+   * @param cost_map the cost map
+   * @return true if a cost under the footprint is at or above the lethal cost
+   * @throw std::out_of_range if no map layer with name `layer` is present.
+   */
+  bool isInCollision(const std::string& layer,
+                     const Position& position,
+                     const double& heading,
+                     const GridMap& cost_map);
+
+  /**
+   * @brief Maximum costs under the footprint for a batch of poses, checked in parallel.
+   *
+   * @param layer the cost layer
+   * @param poses the poses of the robot (x, y, heading per column)
+   * @param cost_map the cost map
+   * @param costs the cost per pose (see getCost())
+   * @param thread_pool the threads to check the poses on
+   * @throw std::out_of_range if no map layer with name `layer` is present.
+   */
+  void getCosts(const std::string& layer,
+                const Eigen::Ref<const Eigen::Matrix3Xd>& poses,
+                const GridMap& cost_map,
+                std::vector<unsigned char>& costs,
+                ThreadPool& thread_pool = ThreadPool::getGlobalPool());
+
+  /**
+   * @brief Maximum cost under the footprint at a pose, on a cost layer directly.
+   *
+   * The tables have to be up to date with the resolution of the map (see update()),
+   * this can then be called concurrently.
+   *
+   * @param data the cost layer
+   * @param indexer the geometry of the cost map
+   * @param position the position of the robot
+   * @param heading the heading of the robot (in [rad])
+   * @return the maximum cost, or the first cost found at or above the lethal cost
+   */
+  unsigned char getCost(const grid_map::Matrix& data,
+                        const GridIndexer& indexer,
+                        const Position& position,
+                        const double& heading) const;
+
+  /**
+   * @brief The discrete heading a heading is snapped to.
+   *
+   * @param heading the heading (in [rad])
+   * @return the index of the discrete heading
+   */
+  unsigned int getHeadingIndex(const double& heading) const;
+
+  /**
+   * @brief Number of discrete headings.
+   */
+  unsigned int getNumberOfHeadings() const;
+
+  /**
+   * @brief Number of cells of the footprint at a discrete heading.
+   *
+   * @param heading_index the index of the discrete heading
+   * @return the number of cells
+   */
+  size_t getNumberOfCells(const unsigned int& heading_index) const;
+
+  /**
+   * @brief The lethal cost (see setLethalCost()).
+   */
+  unsigned char getLethalCost() const;
+
+private:
+  /**
+   * @brief A run of footprint cells in one column, relative to the cell of the robot.
+   */
+  struct Run {
+    int column, row_start, length;
+  };
+
+  Polygon footprint_;
+  unsigned int number_of_headings_;
+  double resolution_;
+  unsigned char lethal_cost_, outside_cost_;
+  std::vector<Run> runs_;
+  std::vector<size_t> heading_begins_;
+  std::vector<Index> min_offsets_, max_offsets_;
+};
+
+/*****************************************************************************
+** Trailers
+*****************************************************************************/
+
+} // namespace grid_map
+
+#endif /* cost_map_core_FOOTPRINT_CHECKER_HPP_ */
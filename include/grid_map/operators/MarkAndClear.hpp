@@ -0,0 +1,143 @@
+/**
+ * @file /cost_map_core/include/cost_map_core/operators/MarkAndClear.hpp
+ */
+/*****************************************************************************
+** Ifdefs
+*****************************************************************************/
+
+#ifndef cost_map_core_MARK_AND_CLEAR_HPP_
+#define cost_map_core_MARK_AND_CLEAR_HPP_
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include "../grid_map_core.hpp"
+#include "Inflation.hpp"
+#include "../RayTemplateCache.hpp"
+#include <limits>
+#include <string>
+#include <vector>
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace grid_map {
+
+/*****************************************************************************
+** Marking and Clearing
+*****************************************************************************/
+
+/**
+ * @brief Functor to ingest a laser scan or point cloud into a cost layer.
+ *
+ * Cells along the rays from the sensor origin to the endpoints are cleared
+ * to FREE_SPACE, the endpoints are then marked as LETHAL_OBSTACLE (like the
+ * obstacle layer of costmap_2d). Rays that end in the same cell trace the same
+ * cells and are only traced once, and every cell is written at most once per
+ * call. The rays are traced on multiple threads.
+ */
+class MarkAndClear {
+public:
+  /**
+   * @brief Configure the ranges and unknown space handling.
+   *
+   * @param obstacle_range endpoints further from the origin are not marked
+   * @param raytrace_range rays are cleared up to this distance from the origin
+   * @param clear_unknown_space if false, cells with NO_INFORMATION stay unknown when cleared
+   */
+  MarkAndClear(const double& obstacle_range = std::numeric_limits<double>::infinity(),
+               const double& raytrace_range = std::numeric_limits<double>::infinity(),
+               const bool& clear_unknown_space = true);
+
+  /**
+   * @brief Set the number of threads for ray tracing.
+   *
+   * @param number_of_threads the number of threads, 0 for the number of hardware threads (default is 1)
+   */
+  void setNumberOfThreads(const unsigned int& number_of_threads);
+
+  /**
+   * @brief Clear along the rays and mark the endpoints.
+   *
+   * @param layer the cost layer to update
+   * @param origin the position of the sensor
+   * @param endpoints the measured points
+   * @param cost_map the cost map
+   * @return true if any cell was updated (see getDirtyRegion())
+   * @throw std::out_of_range if no map layer with name `layer` is present.
+   */
+  bool operator()(const std::string& layer,
+                  const Position& origin,
+                  const std::vector<Position>& endpoints,
+                  GridMap& cost_map
+                 );
+
+  /**
+   * @brief Clear along precomputed ray templates and mark the endpoints.
+   *
+   * The rays are walked from the cell of the origin along the templates (no per ray
+   * line setup). Cells are cleared while their center is more than half a cell before
+   * the measured range along the beam. Beams with a range beyond the templates are
+   * cleared up to the end of the template and not marked. The templates are rebuilt
+   * if the map resolution changed.
+   *
+   * @param layer the cost layer to update
+   * @param origin the position of the sensor
+   * @param ranges the measured range per beam of the templates (NaN for no measurement, infinity for no return)
+   * @param ray_templates the templates of the beams
+   * @param cost_map the cost map
+   * @return true if any cell was updated (see getDirtyRegion())
+   * @throw std::out_of_range if no map layer with name `layer` is present.
+   * @throw std::invalid_argument if the number of ranges does not match the number of beams.
+   */
+  bool operator()(const std::string& layer,
+                  const Position& origin,
+                  const std::vector<double>& ranges,
+                  RayTemplateCache& ray_templates,
+                  GridMap& cost_map
+                 );
+
+  /**
+   * @brief Bounding box of the cells updated by the last call.
+   *
+   * The region can directly be iterated with a SubmapIterator.
+   *
+   * @param start_index the buffer index of the top left cell of the region
+   * @param size the size of the region (zero if nothing was updated)
+   */
+  void getDirtyRegion(Index& start_index, Size& size) const;
+
+private:
+  /**
+   * @brief Mark the endpoints and compute the dirty region.
+   *
+   * @param origin the position of the sensor
+   * @param endpoints the measured points
+   * @param ray_bounds the first and last cell of each ray (buffer indices, -1 if none)
+   * @param indexer the geometry of the cost map
+   * @param data the cost layer
+   * @return true if any cell was updated
+   */
+  bool markEndpoints(const Position& origin,
+                     const std::vector<Position>& endpoints,
+                     const std::vector<Index>& ray_bounds,
+                     const GridIndexer& indexer,
+                     grid_map::Matrix& data
+                    );
+
+  double obstacle_range_, raytrace_range_;
+  bool clear_unknown_space_;
+  unsigned int number_of_threads_;
+  Index dirty_start_index_;
+  Size dirty_size_;
+};
+
+/*****************************************************************************
+** Trailers
+*****************************************************************************/
+
+} // namespace grid_map
+
+#endif /* cost_map_core_MARK_AND_CLEAR_HPP_ */
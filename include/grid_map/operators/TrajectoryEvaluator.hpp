@@ -0,0 +1,126 @@
+/**
+ * @file /cost_map_core/include/cost_map_core/operators/TrajectoryEvaluator.hpp
+ */
+/*****************************************************************************
+** Ifdefs
+*****************************************************************************/
+
+#ifndef cost_map_core_TRAJECTORY_EVALUATOR_HPP_
+#define cost_map_core_TRAJECTORY_EVALUATOR_HPP_
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include "../grid_map_core.hpp"
+#include "FootprintChecker.hpp"
+#include <Eigen/Core>
+#include <string>
+#include <vector>
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace grid_map {
+
+/*****************************************************************************
+** Trajectory Cost
+*****************************************************************************/
+
+/**
+ * @brief Footprint costs along a trajectory.
+ */
+struct TrajectoryCost {
+  /** @brief Maximum footprint cost over the evaluated poses. */
+  unsigned char max_cost;
+  /** @brief Sum of the footprint costs of the evaluated poses. */
+  unsigned long sum_cost;
+  /** @brief Index of the first pose in collision, -1 if there is none. */
+  int first_collision;
+  /** @brief Number of poses evaluated (less than the trajectory if it stopped at a collision). */
+  int number_of_poses;
+};
+
+/*****************************************************************************
+** Trajectory Evaluator
+*****************************************************************************/
+
+/**
+ * @brief Scores batches of trajectories by the footprint costs along them.
+ *
+ * The footprint cost of each pose is the maximum cost under the footprint, from the
+ * heading tables of a FootprintChecker. Trajectories are evaluated in parallel, and
+ * by default stop at their first collision (the sum then covers the poses up to and
+ * including the collision).
+ */
+class TrajectoryEvaluator {
+public:
+  /**
+   * @brief Configure the footprint, the tables are built on the first evaluation.
+   *
+   * @param footprint the footprint polygon in the robot frame
+   * @param number_of_headings the number of discrete headings over the full circle
+   */
+  TrajectoryEvaluator(const Polygon& footprint, const unsigned int& number_of_headings = 64);
+
+  /**
+   * @brief Evaluate every pose, or stop at the first collision (default).
+   *
+   * @param stop_at_collision whether to stop at the first collision
+   */
+  void setStopAtCollision(const bool& stop_at_collision);
+
+  /**
+   * @brief Evaluate a batch of trajectories.
+   *
+   * @param layer the cost layer
+   * @param trajectories the poses of each trajectory (x, y, heading per column)
+   * @param cost_map the cost map
+   * @param costs the costs per trajectory
+   * @param thread_pool the threads to evaluate the trajectories on
+   * @throw std::out_of_range if no map layer with name `layer` is present.
+   */
+  void operator()(const std::string& layer,
+                  const std::vector<Eigen::Matrix3Xd>& trajectories,
+                  const GridMap& cost_map,
+                  std::vector<TrajectoryCost>& costs,
+                  ThreadPool& thread_pool = ThreadPool::getGlobalPool());
+
+  /**
+   * @brief Evaluate a single trajectory.
+   *
+   * @param layer the cost layer
+   * @param trajectory the poses (x, y, heading per column)
+   * @param cost_map the cost map
+   * @return the costs of the trajectory
+   * @throw std::out_of_range if no map layer with name `layer` is present.
+   */
+  TrajectoryCost operator()(const std::string& layer,
+                            const Eigen::Ref<const Eigen::Matrix3Xd>& trajectory,
+                            const GridMap& cost_map);
+
+  /**
+   * @brief The footprint checker, e.g. to configure the lethal and outside costs.
+   */
+  FootprintChecker& getFootprintChecker();
+
+private:
+  /**
+   * @brief Evaluate a trajectory once the footprint tables are up to date.
+   */
+  TrajectoryCost evaluate(const grid_map::Matrix& data,
+                          const GridIndexer& indexer,
+                          const Eigen::Ref<const Eigen::Matrix3Xd>& trajectory) const;
+
+  FootprintChecker footprint_checker_;
+  bool stop_at_collision_;
+};
+
+/*****************************************************************************
+** Trailers
+*****************************************************************************/
+
+} // namespace grid_map
+
+#endif /* cost_map_core_TRAJECTORY_EVALUATOR_HPP_ */
@@ -0,0 +1,128 @@
+/*
+ * DirtyRegionQueue.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include "grid_map/BufferRegion.hpp"
+#include "grid_map/TypeDefs.hpp"
+
+// STL
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace grid_map {
+
+/*!
+ * The regions of a layer changed since they were last taken from a `DirtyRegionQueue`.
+ */
+struct DirtyRegions
+{
+  typedef std::chrono::steady_clock Clock;
+
+  DirtyRegions();
+
+  //! Reset to no changes.
+  void clear();
+
+  //! Start index of the circular buffer at the last post.
+  Index bufferStartIndex;
+
+  //! Changed regions in buffer indices, none overlapping another one completely.
+  std::vector<BufferRegion> regions;
+
+  //! True if the whole layer changed (the regions are then empty).
+  bool isComplete;
+
+  //! Number of posts coalesced into these regions.
+  size_t nPosts;
+
+  //! Time of the first of these posts.
+  Clock::time_point firstPostTime;
+};
+
+/*!
+ * Hands the regions changed by a thread writing a map to a thread displaying it. The
+ * writer posts the regions of each change and continues, the reader takes everything
+ * posted since it last took, at its own rate. Posts in between are coalesced: regions
+ * covered by another region are dropped, and if there are more than `maxRegions`
+ * regions they are merged into their bounding box (in buffer indices), such that the
+ * cost of a post and the size of the queue are bounded.
+ */
+class DirtyRegionQueue
+{
+ public:
+
+  /*!
+   * Constructor.
+   * @param maxRegions the number of regions above which they are merged.
+   */
+  explicit DirtyRegionQueue(const size_t maxRegions = 32);
+
+  /*!
+   * Post the regions of a change (e.g. from `GridMap::move(...)`).
+   * @param bufferStartIndex the start index of the circular buffer after the change.
+   * @param regions the changed regions in buffer indices.
+   */
+  void post(const Index& bufferStartIndex, const std::vector<BufferRegion>& regions);
+
+  /*!
+   * Post a changed region.
+   * @param bufferStartIndex the start index of the circular buffer after the change.
+   * @param region the changed region in buffer indices.
+   */
+  void post(const Index& bufferStartIndex, const BufferRegion& region);
+
+  /*!
+   * Post a change of the whole layer.
+   * @param bufferStartIndex the start index of the circular buffer after the change.
+   */
+  void postComplete(const Index& bufferStartIndex);
+
+  /*!
+   * Take the regions posted since the last call, waiting for a post if there is none.
+   * @param[out] dirtyRegions the coalesced regions.
+   * @param timeout the maximum time to wait.
+   * @return true if there were posts, false on timeout or if the queue is stopped.
+   */
+  bool take(DirtyRegions& dirtyRegions, const std::chrono::milliseconds& timeout);
+
+  /*!
+   * Stop the queue, wakes up a waiting reader. Later posts are ignored.
+   */
+  void stop();
+
+  /*!
+   * Check if the queue is stopped.
+   * @return true if stopped.
+   */
+  bool isStopped() const;
+
+ private:
+
+  //! Add a region to the pending regions (called with the mutex locked).
+  void add(const BufferRegion& region);
+
+  //! Start a post (called with the mutex locked).
+  void begin(const Index& bufferStartIndex);
+
+  //! Regions above which they are merged.
+  size_t maxRegions_;
+
+  //! Regions posted since the last take.
+  DirtyRegions pending_;
+
+  //! True once stopped.
+  bool isStopped_;
+
+  //! Protects the pending regions, signals posts.
+  mutable std::mutex mutex_;
+  std::condition_variable condition_;
+};
+
+} /* namespace grid_map */
@@ -0,0 +1,142 @@
+/*
+ * LayerImageRenderer.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include "grid_map/BufferRegion.hpp"
+#include "grid_map/TypeDefs.hpp"
+
+// STL
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace grid_map {
+
+//! Colors of the 256 cost values as 0xAARRGGBB (the layout of `QRgb` and `QImage::Format_RGB32`).
+typedef std::array<uint32_t, 256> ColorTable;
+
+/*!
+ * Get the default color table for cost layers: a gray ramp from free space (black)
+ * upwards, with inscribed obstacles in orange, lethal obstacles in red and cells
+ * without information in blue.
+ * @return the color table.
+ */
+ColorTable getDefaultCostColorTable();
+
+/*!
+ * Renders a layer into a 32 bit image, applying a color table. The image shows the
+ * layer in map order (pixel (x, y) is the cell with the unwrapped index (y, x)), the
+ * circular buffer is unwrapped while rendering. The column-major layer is transposed
+ * in blocks that fit the cache, such that both the cells and the pixels are accessed
+ * (mostly) sequentially.
+ *
+ * The image is given as pointer to the first pixel and the bytes per line, such that
+ * padded images (e.g. `QImage::bits()` and `QImage::bytesPerLine()`) can be rendered
+ * into directly. The image has (at least) as many lines as the layer has rows and as
+ * many pixels per line as the layer has columns.
+ */
+class LayerImageRenderer
+{
+ public:
+
+  /*!
+   * Constructor.
+   * @param colorTable the color per value.
+   */
+  explicit LayerImageRenderer(const ColorTable& colorTable = getDefaultCostColorTable());
+
+  /*!
+   * Set the color table.
+   * @param colorTable the color per value.
+   */
+  void setColorTable(const ColorTable& colorTable);
+
+  /*!
+   * Get the color table.
+   * @return the color per value.
+   */
+  const ColorTable& getColorTable() const;
+
+  /*!
+   * Renders the whole layer.
+   * @param data the layer.
+   * @param bufferStartIndex the start index of the circular buffer.
+   * @param image the first pixel of the image.
+   * @param bytesPerLine the bytes per line of the image.
+   */
+  void render(const Matrix& data, const Index& bufferStartIndex, uint32_t* image,
+              const size_t bytesPerLine) const;
+
+  /*!
+   * Renders a rectangle of cells given in unwrapped indices (pixel coordinates).
+   * @param data the layer.
+   * @param bufferStartIndex the start index of the circular buffer.
+   * @param startIndex the unwrapped index of the top left cell.
+   * @param size the size of the rectangle (clipped to the layer).
+   * @param image the first pixel of the image.
+   * @param bytesPerLine the bytes per line of the image.
+   */
+  void render(const Matrix& data, const Index& bufferStartIndex, const Index& startIndex,
+              const Size& size, uint32_t* image, const size_t bytesPerLine) const;
+
+  /*!
+   * Renders a rectangle of cells given in unwrapped indices into a separate image of
+   * the size of the rectangle (a tile), i.e. the top left cell is the first pixel.
+   * @param data the layer.
+   * @param bufferStartIndex the start index of the circular buffer.
+   * @param startIndex the unwrapped index of the top left cell.
+   * @param size the size of the rectangle (clipped to the layer).
+   * @param tile the first pixel of the tile.
+   * @param bytesPerLine the bytes per line of the tile.
+   */
+  void renderTile(const Matrix& data, const Index& bufferStartIndex, const Index& startIndex,
+                  const Size& size, uint32_t* tile, const size_t bytesPerLine) const;
+
+  /*!
+   * Renders a region of the buffer, which may cross the wrap of the buffer (as the
+   * regions of `GridMap::move(...)` or the dirty region of `MarkAndClear`).
+   * @param data the layer.
+   * @param bufferStartIndex the start index of the circular buffer.
+   * @param region the region, with the buffer index of the top left cell.
+   * @param image the first pixel of the image.
+   * @param bytesPerLine the bytes per line of the image.
+   */
+  void render(const Matrix& data, const Index& bufferStartIndex, const BufferRegion& region,
+              uint32_t* image, const size_t bytesPerLine) const;
+
+ private:
+
+  /*!
+   * Renders a rectangle of cells given in unwrapped indices.
+   * @param data the layer.
+   * @param bufferStartIndex the start index of the circular buffer.
+   * @param startIndex the unwrapped index of the top left cell.
+   * @param size the size of the rectangle (clipped to the layer).
+   * @param imageIndex the unwrapped index of the first pixel of the image.
+   * @param image the first pixel of the image.
+   * @param bytesPerLine the bytes per line of the image.
+   */
+  void renderRectangle(const Matrix& data, const Index& bufferStartIndex, const Index& startIndex,
+                       const Size& size, const Index& imageIndex, uint32_t* image,
+                       const size_t bytesPerLine) const;
+
+  /*!
+   * Renders a block of cells that is contiguous in the buffer.
+   * @param data the layer.
+   * @param bufferIndex the buffer index of the top left cell.
+   * @param size the size of the block.
+   * @param pixel the pixel of the top left cell.
+   * @param pixelsPerLine the stride of the image in pixels.
+   */
+  void renderBlock(const Matrix& data, const Index& bufferIndex, const Size& size, uint32_t* pixel,
+                   const size_t pixelsPerLine) const;
+
+  //! Color per value.
+  ColorTable colorTable_;
+};
+
+} /* namespace grid_map */
@@ -0,0 +1,130 @@
+/*
+ * LayerPyramid.hpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#pragma once
+
+#include "grid_map/BufferRegion.hpp"
+#include "grid_map/TypeDefs.hpp"
+
+// STL
+#include <cstddef>
+#include <vector>
+
+namespace grid_map {
+
+/*!
+ * Copy of a layer together with max-pooled levels of detail, to display large layers
+ * zoomed out. Each level halves the size of the previous level, a cell of level k is
+ * the maximum of (up to) 2 x 2 cells of level k - 1, such that obstacles stay visible
+ * at every level.
+ *
+ * Level 0 is kept in buffer order, such that a region of the layer is copied as is.
+ * The coarser levels pool the cells in map order (unwrapped) and have the buffer start
+ * index zero, such that no coarse cell mixes cells from opposite edges of the map. A
+ * move of the map shifts the cells of all coarse levels, so they are rebuilt when the
+ * buffer start index changes. Updates without a move only re-pool the changed cells.
+ */
+class LayerPyramid
+{
+ public:
+
+  /*!
+   * Constructor.
+   * @param minSize levels are added until the coarsest level fits in minSize x minSize cells.
+   */
+  explicit LayerPyramid(const int minSize = 256);
+
+  /*!
+   * Copy a layer and build all levels.
+   * @param data the layer.
+   * @param bufferStartIndex the start index of the circular buffer.
+   */
+  void setLayer(const Matrix& data, const Index& bufferStartIndex);
+
+  /*!
+   * Copy a region of a layer and update the levels over it. Rebuilds all levels if the
+   * size of the layer changed and all coarse levels if the buffer start index changed.
+   * @param data the layer.
+   * @param bufferStartIndex the start index of the circular buffer.
+   * @param region the changed region (in buffer indices, as returned by `GridMap::move(...)`).
+   */
+  void update(const Matrix& data, const Index& bufferStartIndex, const BufferRegion& region);
+
+  /*!
+   * Remove the layer.
+   */
+  void clear();
+
+  /*!
+   * Check if there is a layer.
+   * @return true if no layer is set.
+   */
+  bool isEmpty() const;
+
+  /*!
+   * Get the number of levels, including the full resolution level 0.
+   * @return the number of levels.
+   */
+  size_t getNumberOfLevels() const;
+
+  /*!
+   * Get the cells of a level.
+   * @param level the level.
+   * @return the cells of the level (in buffer order for level 0, in map order otherwise).
+   */
+  const Matrix& getLevel(const size_t level) const;
+
+  /*!
+   * Get the size of a level.
+   * @param level the level.
+   * @return the size of the level.
+   */
+  Size getSize(const size_t level = 0) const;
+
+  /*!
+   * Get the buffer start index to show a level with.
+   * @param level the level.
+   * @return the buffer start index of the layer for level 0, zero otherwise.
+   */
+  Index getBufferStartIndex(const size_t level = 0) const;
+
+  /*!
+   * Get the level to show the layer with at a zoom, the finest level whose cells are
+   * not smaller than a pixel (so that no cell is skipped).
+   * @param pixelsPerCell the size of a cell of level 0 on the screen.
+   * @return the level.
+   */
+  size_t getLevelForScale(const double pixelsPerCell) const;
+
+ private:
+
+  /*!
+   * Recompute all coarse levels from level 0.
+   */
+  void poolAll();
+
+  /*!
+   * Recompute a block of cells of a level from the previous level.
+   * @param level the level (> 0).
+   * @param index the first cell of the block (in map order).
+   * @param size the size of the block.
+   */
+  void pool(const size_t level, const Index& index, const Size& size);
+
+  //! Levels are added until the coarsest level is not larger than this.
+  int minSize_;
+
+  //! Cells of the levels, level 0 is the copy of the layer.
+  std::vector<Matrix> levels_;
+
+  //! Start index of the circular buffer (of level 0).
+  Index bufferStartIndex_;
+
+  //! Maximum of two columns (in map order), scratch space of `pool(...)`.
+  std::vector<DataType> columnMax_;
+};
+
+} /* namespace grid_map */
@@ -2,6 +2,10 @@
 #define QT_DISPLAY_HPP
 
 #include "grid_map/GridMap.hpp"
+#include "grid_map/visualization/DirtyRegionQueue.hpp"
+#include "grid_map/visualization/LayerImageRenderer.hpp"
+#include "grid_map/visualization/LayerPyramid.hpp"
+#include <QCache>
 #include <QMainWindow>
 #include <QImage>
 #include <QScrollBar>
@@ -10,22 +14,67 @@
 #include <QWheelEvent>
 #include <QPainter>
 #include <QStyle>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
 
 class NonAntiAliasImage : public QWidget{
     Q_OBJECT
     Q_DISABLE_COPY(NonAntiAliasImage)
 public:
-    explicit NonAntiAliasImage(QWidget* parent = Q_NULLPTR)
-        : QWidget(parent)
-    {}
-    const QPixmap& pixmap() const;
-    void setPixmap(const QPixmap& px);
+    explicit NonAntiAliasImage(QWidget* parent = Q_NULLPTR);
+
+    // size of the layer in cells, the widget shows it stretched to its own size
+    QSize imageSize() const;
+
+    // copies the layer and builds its levels of detail
+    void setLayer(const grid_map::Matrix& data, const grid_map::Index& buffer_start_index);
+
+    // copies only the given regions (buffer indices) of the layer and drops the tiles
+    // showing them (all tiles if the map moved). Can be called from any thread, the
+    // tiles are dropped and redrawn later in the GUI thread. `posted` is the time the
+    // change was posted, to measure the latency until it is painted.
+    void updateLayer(const grid_map::Matrix& data, const grid_map::Index& buffer_start_index,
+                     const std::vector<grid_map::BufferRegion>& dirty_regions,
+                     const std::chrono::steady_clock::time_point& posted = std::chrono::steady_clock::time_point());
+
+    void setColorTable(const grid_map::ColorTable& color_table);
+
+    // latency from posting a change until it is painted, since the last call
+    struct Latency {
+        size_t count = 0;
+        double sum_ms = 0.0;
+        double max_ms = 0.0;
+    };
+    Latency takeLatency();
 
 protected:
-    void paintEvent(QPaintEvent*);
+    // draws the visible tiles only, at the level of detail of the zoom
+    void paintEvent(QPaintEvent* event) override;
+
+private slots:
+    // drops the tiles of the updates since the last call (GUI thread)
+    void applyUpdates();
 
 private:
-    QPixmap m_pixmap;
+    const QPixmap* tile(int level, int row, int column);
+    void invalidateTiles(const grid_map::BufferRegion& region);
+
+    // protects the pyramid and the pending updates, the tiles are GUI thread only
+    mutable std::mutex m_mutex;
+    grid_map::LayerPyramid m_pyramid;
+    grid_map::LayerImageRenderer m_renderer;
+    QCache<quint64, QPixmap> m_tiles;
+
+    std::vector<grid_map::BufferRegion> m_pending_regions;
+    bool m_pending_clear;
+    bool m_update_posted;
+    std::chrono::steady_clock::time_point m_pending_posted;
+    std::chrono::steady_clock::time_point m_unpainted_posted;
+    Latency m_latency;
 };
 
 class ImageViewer : public QScrollArea
@@ -36,16 +85,29 @@ public:
     ImageViewer();
     bool load(const grid_map::Matrix& input_matrix);
 
+    // renders the layer in map order (unwrapping the circular buffer)
+    bool load(const grid_map::GridMap& map, const std::string& layer);
+
+    // re-renders only the given regions (buffer indices, as returned by
+    // GridMap::move() or MarkAndClear::getDirtyRegion()), follows moves of the map
+    bool updateRegions(const grid_map::GridMap& map, const std::string& layer,
+                       const std::vector<grid_map::BufferRegion>& dirty_regions);
+
+    void setColorTable(const grid_map::ColorTable& color_table);
+
+    NonAntiAliasImage* imageWidget() const;
+
 private:
 
-    void setImage(const QImage &newImage);
+    bool load(const grid_map::Matrix& matrix, const grid_map::Index& buffer_start_index);
+
+    void resetScale();
     void scaleImage(double factor);
 
     void adjustScrollBar(QScrollBar *scrollBar, double factor);
 
     void wheelEvent(QWheelEvent *event) override;
 
-    QImage image;
     NonAntiAliasImage *image_widget_;
     double scaleFactor;
 
@@ -53,4 +115,39 @@ private:
     QAction *fitToWindowAct;
 };
 
+// Shows a layer that another thread keeps updating. The writer changes the map while
+// holding map_mutex and posts the changed regions to queue(), it never waits for the
+// display. The render thread wakes up at most max_rate times per second, copies the
+// regions posted since its last frame (holding map_mutex only for the copy) and
+// updates the levels of detail of the viewer, the GUI thread then only redraws the
+// dropped tiles.
+class LiveView
+{
+public:
+    LiveView(ImageViewer* viewer, const grid_map::GridMap& map, const std::string& layer,
+             std::mutex& map_mutex, double max_rate = 60.0);
+    ~LiveView();
+
+    grid_map::DirtyRegionQueue& queue();
+
+    // frames rendered and posts coalesced into them
+    size_t frames() const;
+    size_t posts() const;
+
+private:
+    void run();
+
+    NonAntiAliasImage* image_widget_;
+    const grid_map::GridMap& map_;
+    std::string layer_;
+    std::mutex& map_mutex_;
+    std::chrono::steady_clock::duration period_;
+    grid_map::DirtyRegionQueue queue_;
+    // copy of the layer, owned by the render thread
+    grid_map::Matrix layer_copy_;
+    std::atomic<size_t> frames_;
+    std::atomic<size_t> posts_;
+    std::thread thread_;
+};
+
 #endif // QT_DISPLAY_HPP
@@ -0,0 +1,86 @@
+/*
+ * GridIndexer.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map/GridIndexer.hpp"
+#include "grid_map/GridMapMath.hpp"
+
+namespace grid_map {
+
+GridIndexer::GridIndexer()
+    : GridIndexer(Length::Zero(), Position::Zero(), 0.0, Size::Zero())
+{
+}
+
+GridIndexer::GridIndexer(const Length& mapLength, const Position& mapPosition, const double resolution,
+                         const Size& bufferSize, const Index& bufferStartIndex)
+    : length_(mapLength),
+      position_(mapPosition),
+      resolution_(resolution),
+      size_(bufferSize),
+      startIndex_(bufferStartIndex)
+{
+  isDefaultStartIndex_ = (startIndex_ == 0).all();
+  isPowerOfTwo_ = isPowerOfTwo(size_(0)) && isPowerOfTwo(size_(1));
+  wrapMask_ = size_ - 1;
+  vectorToOrigin_ = (0.5 * length_).matrix();
+  firstCellPosition_ = position_ + (vectorToOrigin_.array() - 0.5 * resolution_).matrix();
+}
+
+void GridIndexer::getIndexCoordinatesFromPositions(const Eigen::Ref<const Eigen::Matrix2Xd>& positions,
+                                                   Eigen::Array2Xd& coordinates) const
+{
+  coordinates = -(((positions.colwise() - vectorToOrigin_).colwise() - position_).array() / resolution_);
+}
+
+size_t GridIndexer::getIndicesFromPositions(const Eigen::Ref<const Eigen::Matrix2Xd>& positions,
+                                            Eigen::Array2Xi& indices,
+                                            Eigen::Array<bool, Eigen::Dynamic, 1>& isValid) const
+{
+  const Eigen::Index nPositions = positions.cols();
+  const Eigen::Array2Xd distance = -((positions.colwise() - position_).colwise() - vectorToOrigin_).array();
+  const Eigen::Array2Xd lengths = length_.replicate(1, nPositions);
+  isValid = (distance.row(0) >= 0.0 && distance.row(1) >= 0.0
+      && distance.row(0) < lengths.row(0) && distance.row(1) < lengths.row(1)).transpose();
+
+  const Eigen::Array2Xd maxIndex = (size_ - 1).cast<double>().replicate(1, nPositions);
+  const Eigen::Array2Xi unwrappedIndices = (distance / resolution_).floor().max(0.0).min(maxIndex).cast<int>();
+  getBufferIndicesFromIndices(unwrappedIndices, indices);
+  return isValid.count();
+}
+
+void GridIndexer::getPositionsFromIndices(const Eigen::Ref<const Eigen::Array2Xi>& indices,
+                                          Eigen::Matrix2Xd& positions) const
+{
+  const Eigen::Index nIndices = indices.cols();
+  Eigen::Array2Xi unwrappedIndices = indices - startIndex_.replicate(1, nIndices);
+  if (isPowerOfTwo_) {
+    unwrappedIndices.row(0) = unwrappedIndices.row(0).unaryExpr([this](int i) { return i & wrapMask_(0); });
+    unwrappedIndices.row(1) = unwrappedIndices.row(1).unaryExpr([this](int i) { return i & wrapMask_(1); });
+  } else {
+    unwrappedIndices = (unwrappedIndices < 0).select(unwrappedIndices + size_.replicate(1, nIndices), unwrappedIndices);
+  }
+  positions = ((-resolution_ * unwrappedIndices.cast<double>()).colwise() + firstCellPosition_.array()).matrix();
+}
+
+void GridIndexer::getBufferIndicesFromIndices(const Eigen::Ref<const Eigen::Array2Xi>& indices,
+                                              Eigen::Array2Xi& bufferIndices) const
+{
+  if (isDefaultStartIndex_) {
+    bufferIndices = indices;
+    return;
+  }
+  const Eigen::Index nIndices = indices.cols();
+  bufferIndices = indices + startIndex_.replicate(1, nIndices);
+  if (isPowerOfTwo_) {
+    bufferIndices.row(0) = bufferIndices.row(0).unaryExpr([this](int i) { return i & wrapMask_(0); });
+    bufferIndices.row(1) = bufferIndices.row(1).unaryExpr([this](int i) { return i & wrapMask_(1); });
+    return;
+  }
+  const Eigen::Array2Xi sizes = size_.replicate(1, nIndices);
+  bufferIndices = (bufferIndices >= sizes).select(bufferIndices - sizes, bufferIndices);
+}
+
+} /* namespace grid_map */
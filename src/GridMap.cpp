@@ -9,6 +9,8 @@
 #include "grid_map/GridMap.hpp"
 #include "grid_map/GridMapMath.hpp"
 #include "grid_map/SubmapGeometry.hpp"
+#include "grid_map/PolygonRasterizer.hpp"
+#include "grid_map/ParallelForEach.hpp"
 #include "grid_map/iterators/GridMapIterator.hpp"
 
 #include <Eigen/Dense>
@@ -30,6 +32,7 @@ GridMap::GridMap(const std::vector<std::string>& layers)
   length_.setZero();
   resolution_ = 0.0;
   size_.setZero();
+  bufferMode_ = BufferMode::DEFAULT;
   startIndex_.setZero();
   timestamp_ = 0;
   layers_ = layers;
@@ -58,6 +61,11 @@ void GridMap::setGeometry(const Length& length, const double resolution,
   Size size;
   size(0) = static_cast<int>(round(length(0) / resolution)); // There is no round() function in Eigen.
   size(1) = static_cast<int>(round(length(1) / resolution));
+  if (bufferMode_ == BufferMode::POWER_OF_TWO) {
+    for (int i = 0; i < size.size(); ++i) {
+      size(i) = getNextPowerOfTwo(size(i));
+    }
+  }
   resize(size);
   clearAll();
 
@@ -65,6 +73,7 @@ void GridMap::setGeometry(const Length& length, const double resolution,
   length_ = (size_.cast<double>() * resolution_).matrix();
   position_ = position;
   startIndex_.setZero();
+  updateIndexer();
 
   return;
 }
@@ -74,6 +83,16 @@ void GridMap::setGeometry(const SubmapGeometry& geometry)
   setGeometry(geometry.getLength(), geometry.getResolution(), geometry.getPosition());
 }
 
+void GridMap::setBufferMode(const BufferMode bufferMode)
+{
+  bufferMode_ = bufferMode;
+}
+
+BufferMode GridMap::getBufferMode() const
+{
+  return bufferMode_;
+}
+
 void GridMap::setBasicLayers(const std::vector<std::string>& basicLayers)
 {
   basicLayers_ = basicLayers;
@@ -206,6 +225,72 @@ Matrix::Scalar GridMap::atPosition(const std::string& layer, const Position& pos
   }
 }
 
+size_t GridMap::atPositions(const std::string& layer, const Eigen::Ref<const Eigen::Matrix2Xd>& positions,
+                            Eigen::Matrix<Matrix::Scalar, Eigen::Dynamic, 1>& values,
+                            Eigen::Array<bool, Eigen::Dynamic, 1>& isValid,
+                            InterpolationMethods interpolationMethod) const
+{
+  if (interpolationMethod != InterpolationMethods::INTER_NEAREST
+      && interpolationMethod != InterpolationMethods::INTER_LINEAR) {
+    throw std::runtime_error("GridMap::atPositions(...) : Specified interpolation method not implemented.");
+  }
+
+  const Matrix& data = get(layer);
+  const Eigen::Index nPositions = positions.cols();
+  values.resize(nPositions);
+  isValid.resize(nPositions);
+  if (nPositions == 0) return 0;
+
+  Eigen::Array2Xi bufferIndices;
+  indexer_.getIndicesFromPositions(positions, bufferIndices, isValid);
+  const Eigen::ArrayXi linearIndices = (bufferIndices.row(1) * size_(0) + bufferIndices.row(0)).transpose();
+
+  const Matrix::Scalar* layerData = data.data();
+  for (Eigen::Index i = 0; i < nPositions; ++i) {
+    values(i) = layerData[linearIndices(i)];
+  }
+
+  if (interpolationMethod == InterpolationMethods::INTER_LINEAR) {
+    // Bilinear interpolation between the centers of the 2x2 neighboring cells. Cell centers
+    // lie at half-integer coordinates, shift them to the integers for the interpolation.
+    Eigen::Array2Xd coordinates;
+    indexer_.getIndexCoordinatesFromPositions(positions, coordinates);
+    const Eigen::Array2Xd maxIndex = (size_ - 1).cast<double>().replicate(1, nPositions);
+    const Eigen::Array2Xd centerCoordinates = coordinates - 0.5;
+    const Eigen::Array2Xd lowerCoordinates = centerCoordinates.floor();
+    const Eigen::Array2Xd fractions = centerCoordinates - lowerCoordinates;
+    const Eigen::Array<bool, Eigen::Dynamic, 1> hasNeighbors = isValid
+        && (lowerCoordinates.row(0) >= 0.0 && lowerCoordinates.row(1) >= 0.0
+            && lowerCoordinates.row(0) < maxIndex.row(0) && lowerCoordinates.row(1) < maxIndex.row(1)).transpose();
+    const Eigen::Array2Xi lowerIndices = lowerCoordinates.max(0.0).min(maxIndex).cast<int>();
+
+    // Gather the four neighbors (rows/cols wrapped into the circular buffer).
+    const Eigen::Array2Xi sizes = size_.replicate(1, nPositions);
+    Eigen::Array2Xi lowerBufferIndices;
+    indexer_.getBufferIndicesFromIndices(lowerIndices, lowerBufferIndices);
+    Eigen::Array2Xi upperBufferIndices = lowerBufferIndices + 1;
+    upperBufferIndices = (upperBufferIndices >= sizes).select(upperBufferIndices - sizes, upperBufferIndices);
+    Eigen::Array4Xd corners(4, nPositions);
+    for (Eigen::Index i = 0; i < nPositions; ++i) {
+      const int rows[2] = {lowerBufferIndices(0, i), upperBufferIndices(0, i)};
+      const int cols[2] = {lowerBufferIndices(1, i) * size_(0), upperBufferIndices(1, i) * size_(0)};
+      corners(0, i) = layerData[cols[0] + rows[0]];
+      corners(1, i) = layerData[cols[0] + rows[1]];
+      corners(2, i) = layerData[cols[1] + rows[0]];
+      corners(3, i) = layerData[cols[1] + rows[1]];
+    }
+
+    const Eigen::Array2Xd complements = 1.0 - fractions;
+    const Eigen::ArrayXd interpolated = (complements.row(0) * complements.row(1) * corners.row(0)
+        + fractions.row(0) * complements.row(1) * corners.row(1)
+        + complements.row(0) * fractions.row(1) * corners.row(2)
+        + fractions.row(0) * fractions.row(1) * corners.row(3)).transpose();
+    values = hasNeighbors.select(interpolated.cast<Matrix::Scalar>(), values.array()).matrix();
+  }
+
+  return isValid.count();
+}
+
 Matrix::Scalar& GridMap::at(const std::string& layer, const Index& index)
 {
   try {
@@ -226,17 +311,17 @@ Matrix::Scalar GridMap::at(const std::string& layer, const Index& index) const
 
 bool GridMap::getIndex(const Position& position, Index& index) const
 {
-  return getIndexFromPosition(index, position, length_, position_, resolution_, size_, startIndex_);
+  return indexer_.getIndexFromPosition(index, position);
 }
 
 bool GridMap::getPosition(const Index& index, Position& position) const
 {
-  return getPositionFromIndex(position, index, length_, position_, resolution_, size_, startIndex_);
+  return indexer_.getPositionFromIndex(position, index);
 }
 
 bool GridMap::isInside(const Position& position) const
 {
-  return checkIfPositionWithinMap(position, length_, position_);
+  return indexer_.isInside(position);
 }
 
 bool GridMap::isValid(const Index& index) const
@@ -305,6 +390,7 @@ GridMap GridMap::getSubmap(const Position& position, const Length& length,
   if (isSuccess == false) return GridMap(layers_);
   submap.setGeometry(submapInformation);
   submap.startIndex_.setZero(); // Because of the way we copy the data below.
+  submap.updateIndexer();
 
   // Copy data.
   std::vector<BufferRegion> bufferRegions;
@@ -341,6 +427,7 @@ GridMap GridMap::getSubmap(const Position& position, const Length& length,
 void GridMap::setPosition(const Position& position)
 {
   position_ = position;
+  updateIndexer();
 }
 
 bool GridMap::move(const Position& position, std::vector<BufferRegion>& newRegions)
@@ -406,6 +493,7 @@ bool GridMap::move(const Position& position, std::vector<BufferRegion>& newRegio
   startIndex_ += indexShift;
   wrapIndexToRange(startIndex_, getSize());
   position_ += alignedPositionShift;
+  updateIndexer();
 
   // Check if map has been moved at all.
   return (indexShift.any() != 0);
@@ -432,19 +520,27 @@ bool GridMap::addDataFrom(const GridMap& other, bool extendMap, bool overwriteDa
       add(layer);
     }
   }
-  // Copy data.
-  for (GridMapIterator iterator(*this); !iterator.isPastEnd(); ++iterator) {
-    if (isValid(*iterator) && !overwriteData) continue;
+  // Copy data, the cells are distributed over threads (each cell is written by one thread).
+  std::vector<Matrix*> data;
+  std::vector<const Matrix*> otherData;
+  for (const auto& layer : layers) {
+    data.push_back(&get(layer));
+    otherData.push_back(&other.get(layer));
+  }
+  std::vector<Span> spans;
+  GridMapIterator(*this).getSpans(spans);
+  parallelForEachCell(spans, [&](const Index& index) {
+    if (isValid(index) && !overwriteData) return;
     Position position;
-    getPosition(*iterator, position);
-    Index index;
-    if (!other.isInside(position)) continue;
-    other.getIndex(position, index);
-    for (const auto& layer : layers) {
-      if (!other.isValid(index, layer)) continue;
-      at(layer, *iterator) = other.at(layer, index);
+    getPosition(index, position);
+    Index otherIndex;
+    if (!other.isInside(position)) return;
+    other.getIndex(position, otherIndex);
+    for (size_t i = 0; i < layers.size(); ++i) {
+      if (!other.isValid(otherIndex, layers[i])) continue;
+      (*data[i])(index(0), index(1)) = (*otherData[i])(otherIndex(0), otherIndex(1));
     }
-  }
+  });
 
   return true;
 }
@@ -504,6 +600,7 @@ bool GridMap::extendToInclude(const GridMap& other)
     if (size_.y() % 2 != mapCopy.getSize().y() % 2) {
       position_.y() += -std::copysign(resolution_ / 2.0, shift.y());
     }
+    updateIndexer();
     // Copy data.
     for (GridMapIterator iterator(*this); !iterator.isPastEnd(); ++iterator) {
       if (isValid(*iterator)) continue;
@@ -567,6 +664,7 @@ const Size& GridMap::getSize() const
 
 void GridMap::setStartIndex(const Index& startIndex) {
   startIndex_ = startIndex;
+  updateIndexer();
 }
 
 const Index& GridMap::getStartIndex() const
@@ -574,6 +672,11 @@ const Index& GridMap::getStartIndex() const
   return startIndex_;
 }
 
+const GridIndexer& GridMap::getIndexer() const
+{
+  return indexer_;
+}
+
 bool GridMap::isDefaultStartIndex() const
 {
   return (startIndex_ == 0).all();
@@ -608,6 +711,7 @@ void GridMap::convertToDefaultStartIndex()
   }
 
   startIndex_.setZero();
+  updateIndexer();
 }
 
 void GridMap::clear(const std::string& layer)
@@ -628,8 +732,22 @@ void GridMap::clearBasic()
 
 void GridMap::clearAll()
 {
-  for (auto& data : data_) {
-    data.second.setConstant(NAN);
+  std::vector<Matrix*> data;
+  for (auto& layerData : data_) data.push_back(&layerData.second);
+  std::vector<Span> spans;
+  GridMapIterator(*this).getSpans(spans);
+  parallelForEachSpan(spans, [&data](const Span& span) {
+    for (const auto layerData : data) span.segment(*layerData).setConstant(NAN);
+  });
+}
+
+void GridMap::fillPolygon(const std::string& layer, const Polygon& polygon, const DataType value)
+{
+  Matrix& data = get(layer);
+  std::vector<Span> spans;
+  PolygonRasterizer(*this).getSpans(polygon, spans);
+  for (const auto& span : spans) {
+    span.segment(data).setConstant(value);
   }
 }
 
@@ -709,6 +827,11 @@ bool GridMap::atPositionLinearInterpolated(const std::string& layer, const Posit
   return true;
 }
 
+void GridMap::updateIndexer()
+{
+  indexer_ = GridIndexer(length_, position_, resolution_, size_, startIndex_);
+}
+
 void GridMap::resize(const Index& size)
 {
   size_ = size;
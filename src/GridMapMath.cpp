@@ -7,6 +7,7 @@
  */
 
 #include "grid_map/GridMapMath.hpp"
+#include "grid_map/GridIndexer.hpp"
 
 // fabs
 #include <cmath>
@@ -14,6 +15,9 @@
 // Limits
 #include <limits>
 
+// min
+#include <algorithm>
+
 using namespace std;
 
 namespace grid_map {
@@ -33,25 +37,6 @@ inline bool getVectorToOrigin(Vector& vectorToOrigin, const Length& mapLength)
   return true;
 }
 
-/*!
- * Gets the vector from the center of the map to the center
- * of the first cell of the map data.
- * @param[out] vectorToFirstCell the vector from the center of the cell to the center of the map.
- * @param[in] mapLength the lengths in x and y direction.
- * @param[in] resolution the resolution of the map.
- * @return true if successful.
- */
-inline bool getVectorToFirstCell(Vector& vectorToFirstCell,
-                                 const Length& mapLength, const double& resolution)
-{
-  Vector vectorToOrigin;
-  getVectorToOrigin(vectorToOrigin, mapLength);
-
-  // Vector to center of cell.
-  vectorToFirstCell = (vectorToOrigin.array() - 0.5 * resolution).matrix();
-  return true;
-}
-
 inline Eigen::Matrix2i getBufferOrderToMapFrameTransformation()
 {
   return -Eigen::Matrix2i::Identity();
@@ -67,25 +52,6 @@ inline bool checkIfStartIndexAtDefaultPosition(const Index& bufferStartIndex)
   return ((bufferStartIndex == 0).all());
 }
 
-inline Vector getIndexVectorFromIndex(
-    const Index& index,
-    const Size& bufferSize,
-    const Index& bufferStartIndex)
-{
-  Index unwrappedIndex;
-  unwrappedIndex = getIndexFromBufferIndex(index, bufferSize, bufferStartIndex);
-  return (getBufferOrderToMapFrameTransformation() * unwrappedIndex.matrix()).cast<double>();
-}
-
-inline Index getIndexFromIndexVector(
-    const Vector& indexVector,
-    const Size& bufferSize,
-    const Index& bufferStartIndex)
-{
-  Index index = (getMapFrameToBufferOrderTransformation() * indexVector.cast<int>()).array();
-  return getBufferIndexFromIndex(index, bufferSize, bufferStartIndex);
-}
-
 inline BufferRegion::Quadrant getQuadrant(const Index& index, const Index& bufferStartIndex)
 {
   if (index[0] >= bufferStartIndex[0] && index[1] >= bufferStartIndex[1]) return BufferRegion::Quadrant::TopLeft;
@@ -107,11 +73,7 @@ bool getPositionFromIndex(Position& position,
                           const Size& bufferSize,
                           const Index& bufferStartIndex)
 {
-  if (!checkIfIndexInRange(index, bufferSize)) return false;
-  Vector offset;
-  getVectorToFirstCell(offset, mapLength, resolution);
-  position = mapPosition + offset + resolution * getIndexVectorFromIndex(index, bufferSize, bufferStartIndex);
-  return true;
+  return GridIndexer(mapLength, mapPosition, resolution, bufferSize, bufferStartIndex).getPositionFromIndex(position, index);
 }
 
 bool getIndexFromPosition(Index& index,
@@ -122,12 +84,7 @@ bool getIndexFromPosition(Index& index,
                           const Size& bufferSize,
                           const Index& bufferStartIndex)
 {
-  Vector offset;
-  getVectorToOrigin(offset, mapLength);
-  Vector indexVector = ((position - offset - mapPosition).array() / resolution).matrix();
-  index = getIndexFromIndexVector(indexVector, bufferSize, bufferStartIndex);
-  if (!checkIfPositionWithinMap(position, mapLength, mapPosition)) return false;
-  return true;
+  return GridIndexer(mapLength, mapPosition, resolution, bufferSize, bufferStartIndex).getIndexFromPosition(index, position);
 }
 
 bool checkIfPositionWithinMap(const Position& position,
@@ -208,10 +165,29 @@ void wrapIndexToRange(Index& index, const Size& bufferSize)
 
 void wrapIndexToRange(int& index, const int& bufferSize)
 {
+  if (isPowerOfTwo(bufferSize)) {
+    // Two's complement: masking maps negative indices into the range as well.
+    index &= bufferSize - 1;
+    return;
+  }
   if (index < 0) index += ((-index / bufferSize) + 1) * bufferSize;
   index = index % bufferSize;
 }
 
+int getNextPowerOfTwo(const int bufferSize)
+{
+  int powerOfTwo = 1;
+  while (powerOfTwo < bufferSize) powerOfTwo <<= 1;
+  return powerOfTwo;
+}
+
+int getPowerOfTwoExponent(const int powerOfTwo)
+{
+  int exponent = 0;
+  while ((1 << exponent) < powerOfTwo) ++exponent;
+  return exponent;
+}
+
 void boundPositionToRange(Position& position, const Length& mapLength, const Position& mapPosition)
 {
   Vector vectorToOrigin;
@@ -410,6 +386,29 @@ bool getBufferRegionsForSubmap(std::vector<BufferRegion>& submapBufferRegions,
   return false;
 }
 
+bool getSpansForSubmap(std::vector<Span>& spans,
+                       const Index& submapIndex,
+                       const Size& submapBufferSize,
+                       const Size& bufferSize,
+                       const Index& bufferStartIndex)
+{
+  if ((getIndexFromBufferIndex(submapIndex, bufferSize, bufferStartIndex) + submapBufferSize > bufferSize).any()) return false;
+
+  spans.clear();
+  if ((submapBufferSize <= 0).any()) return true;
+  spans.reserve(2 * submapBufferSize(1));
+
+  const int firstLength = std::min(submapBufferSize(0), bufferSize(0) - submapIndex(0));
+  const int secondLength = submapBufferSize(0) - firstLength;
+  int column = submapIndex(1);
+  for (int j = 0; j < submapBufferSize(1); ++j) {
+    spans.emplace_back(column, submapIndex(0), firstLength);
+    if (secondLength > 0) spans.emplace_back(column, 0, secondLength);
+    if (++column == bufferSize(1)) column = 0;
+  }
+  return true;
+}
+
 bool incrementIndex(Index& index, const Size& bufferSize, const Index& bufferStartIndex)
 {
   Index unwrappedIndex = getIndexFromBufferIndex(index, bufferSize, bufferStartIndex);
@@ -0,0 +1,36 @@
+/*
+ * ParallelForEach.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map/ParallelForEach.hpp"
+
+#include <algorithm>
+
+namespace grid_map {
+
+void getSpanChunks(const std::vector<Span>& spans, const size_t grainSize, std::vector<Span>& pieces,
+                   std::vector<size_t>& chunkBegins)
+{
+  const int chunkSize = static_cast<int>(std::max<size_t>(std::min<size_t>(grainSize, 1 << 30), 1));
+  pieces.clear();
+  chunkBegins.clear();
+  chunkBegins.push_back(0);
+  int nChunkCells = 0;
+  for (const auto& span : spans) {
+    for (int offset = 0; offset < span.length;) {
+      const int length = std::min(span.length - offset, chunkSize - nChunkCells);
+      pieces.emplace_back(span.column, span.rowStart + offset, length);
+      offset += length;
+      nChunkCells += length;
+      if (nChunkCells == chunkSize) {
+        chunkBegins.push_back(pieces.size());
+        nChunkCells = 0;
+      }
+    }
+  }
+  if (nChunkCells > 0) chunkBegins.push_back(pieces.size());
+}
+
+} /* namespace grid_map */
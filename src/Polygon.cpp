@@ -11,6 +11,8 @@
 #include <Eigen/Core>
 #include <Eigen/Geometry>
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
 
 namespace grid_map {
@@ -42,6 +44,99 @@ bool Polygon::isInside(const Position& point) const
   return bool(cross % 2);
 }
 
+size_t Polygon::isInside(const Eigen::Ref<const Eigen::Matrix2Xd>& points,
+                         Eigen::Array<bool, Eigen::Dynamic, 1>& isInside) const
+{
+  const Eigen::Index nPoints = points.cols();
+  isInside.setConstant(nPoints, false);
+  if (vertices_.size() < 3 || nPoints == 0) return 0;
+
+  Eigen::Array2d boxMin = vertices_[0].array(), boxMax = boxMin;
+  for (const auto& vertex : vertices_) {
+    boxMin = boxMin.min(vertex.array());
+    boxMax = boxMax.max(vertex.array());
+  }
+
+  // Convex polygons: a * x + b * y <= c for all half-planes. Otherwise the edge
+  // coefficients of the crossing test: an edge is crossed by the ray in +x from (x, y)
+  // if yMin <= y < yMax and x < xI + slope * (y - yI).
+  const bool convex = isConvex();
+  Eigen::MatrixXd A;
+  Eigen::VectorXd b;
+  Eigen::Array<double, 5, Eigen::Dynamic> edges;
+  if (convex) {
+    convertToInequalityConstraints(A, b);
+  } else {
+    edges.resize(5, vertices_.size());
+    Eigen::Index nEdges = 0;
+    for (size_t i = 0, j = vertices_.size() - 1; i < vertices_.size(); j = i++) {
+      const Position& vertexI = vertices_[i];
+      const Position& vertexJ = vertices_[j];
+      if (vertexI.y() == vertexJ.y()) continue;
+      edges.col(nEdges++) << std::min(vertexI.y(), vertexJ.y()), std::max(vertexI.y(), vertexJ.y()),
+          vertexI.x(), vertexI.y(), (vertexJ.x() - vertexI.x()) / (vertexJ.y() - vertexI.y());
+    }
+    edges.conservativeResize(5, nEdges);
+  }
+
+  // Blocks of contiguous coordinates, such that the tests vectorize over the points.
+  const Eigen::Index blockSize = 256;
+  Eigen::ArrayXd x(std::min(blockSize, nPoints)), y(x.size());
+  Eigen::ArrayXi crossings(x.size());
+  Eigen::Array<bool, Eigen::Dynamic, 1> inside(x.size());
+  size_t nInside = 0;
+  for (Eigen::Index begin = 0; begin < nPoints; begin += blockSize) {
+    const Eigen::Index n = std::min(blockSize, nPoints - begin);
+    x.head(n) = points.row(0).segment(begin, n).transpose().array();
+    y.head(n) = points.row(1).segment(begin, n).transpose().array();
+    inside.head(n) = x.head(n) >= boxMin.x() && x.head(n) <= boxMax.x()
+        && y.head(n) >= boxMin.y() && y.head(n) <= boxMax.y();
+    if (!inside.head(n).any()) continue;
+    if (convex) {
+      for (Eigen::Index k = 0; k < A.rows(); ++k) {
+        inside.head(n) = inside.head(n) && (A(k, 0) * x.head(n) + A(k, 1) * y.head(n) <= b(k));
+      }
+    } else {
+      crossings.head(n).setZero();
+      for (Eigen::Index k = 0; k < edges.cols(); ++k) {
+        crossings.head(n) += (y.head(n) >= edges(0, k) && y.head(n) < edges(1, k)
+            && x.head(n) < edges(2, k) + edges(4, k) * (y.head(n) - edges(3, k))).cast<int>();
+      }
+      inside.head(n) = inside.head(n) && crossings.head(n).unaryExpr([](const int c) { return c & 1; }) != 0;
+    }
+    isInside.segment(begin, n) = inside.head(n);
+    nInside += inside.head(n).count();
+  }
+  return nInside;
+}
+
+bool Polygon::isConvex() const
+{
+  // Edges of zero length (e.g. a repeated closing vertex) do not define a turn.
+  std::vector<Vector> edges;
+  edges.reserve(vertices_.size());
+  for (size_t i = 0; i < vertices_.size(); ++i) {
+    const Vector edge = vertices_[(i + 1) % vertices_.size()] - vertices_[i];
+    if (!edge.isZero()) edges.push_back(edge);
+  }
+  if (edges.size() < 3) return false;
+  int direction = 0;
+  double turning = 0.0;
+  for (size_t i = 0; i < edges.size(); ++i) {
+    const Vector& edge = edges[i];
+    const Vector& nextEdge = edges[(i + 1) % edges.size()];
+    const double cross = computeCrossProduct2D(edge, nextEdge);
+    if (cross != 0.0) {
+      const int turn = cross > 0.0 ? 1 : -1;
+      if (direction != 0 && turn != direction) return false;
+      direction = turn;
+    }
+    turning += std::atan2(cross, edge.dot(nextEdge));
+  }
+  // A convex polygon winds around once, a star shaped one with the same turns more often.
+  return direction != 0 && std::abs(std::abs(turning) - 2.0 * M_PI) < 1e-6;
+}
+
 void Polygon::addVertex(const Position& vertex)
 {
   vertices_.push_back(vertex);
@@ -173,7 +268,7 @@ bool Polygon::convertToInequalityConstraints(Eigen::MatrixXd& A, Eigen::VectorXd
     }
   }
 
-  A = A.topRows(rc);
+  A.conservativeResize(rc, Eigen::NoChange);
   b = Eigen::VectorXd::Ones(A.rows());
   b = b + A * c.transpose();
 
@@ -0,0 +1,238 @@
+/*
+ * PolygonIndex.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map/PolygonIndex.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+namespace grid_map {
+
+PolygonIndex::PolygonIndex(const double bucketSize, const size_t maxBucketsPerPolygon)
+    : bucketSize_(bucketSize),
+      maxBucketsPerPolygon_(maxBucketsPerPolygon)
+{
+  assert(bucketSize_ > 0.0);
+}
+
+PolygonIndex::Id PolygonIndex::insert(const Polygon& polygon)
+{
+  Id id;
+  if (freeIds_.empty()) {
+    id = entries_.size();
+    entries_.emplace_back();
+  } else {
+    id = freeIds_.back();
+    freeIds_.pop_back();
+  }
+
+  Entry& entry = entries_[id];
+  entry.polygon = polygon;
+  entry.isValid = true;
+  entry.boxMin.setConstant(std::numeric_limits<double>::infinity());
+  entry.boxMax.setConstant(-std::numeric_limits<double>::infinity());
+  for (const auto& vertex : polygon.getVertices()) {
+    entry.boxMin = entry.boxMin.min(vertex.array());
+    entry.boxMax = entry.boxMax.max(vertex.array());
+  }
+
+  entry.isBucketed = false;
+  if (polygon.nVertices() > 0) {
+    Eigen::Array2i bucketMin, bucketMax;
+    getBucketRange(entry.boxMin, entry.boxMax, bucketMin, bucketMax);
+    const Eigen::Array2d nBuckets = (bucketMax - bucketMin + 1).cast<double>();
+    entry.isBucketed = nBuckets.prod() <= maxBucketsPerPolygon_;
+    if (entry.isBucketed) {
+      for (int x = bucketMin.x(); x <= bucketMax.x(); ++x) {
+        for (int y = bucketMin.y(); y <= bucketMax.y(); ++y) {
+          buckets_[getKey(x, y)].push_back(id);
+        }
+      }
+    }
+  }
+  if (!entry.isBucketed) unbucketed_.push_back(id);
+  return id;
+}
+
+void PolygonIndex::insert(const std::vector<Polygon>& polygons, std::vector<Id>* ids)
+{
+  if (polygons.size() > freeIds_.size()) {
+    entries_.reserve(entries_.size() + polygons.size() - freeIds_.size());
+  }
+  if (ids != nullptr) {
+    ids->clear();
+    ids->reserve(polygons.size());
+  }
+  for (const auto& polygon : polygons) {
+    const Id id = insert(polygon);
+    if (ids != nullptr) ids->push_back(id);
+  }
+}
+
+bool PolygonIndex::remove(const Id id)
+{
+  if (!exists(id)) return false;
+  Entry& entry = entries_[id];
+  if (entry.isBucketed) {
+    Eigen::Array2i bucketMin, bucketMax;
+    getBucketRange(entry.boxMin, entry.boxMax, bucketMin, bucketMax);
+    for (int x = bucketMin.x(); x <= bucketMax.x(); ++x) {
+      for (int y = bucketMin.y(); y <= bucketMax.y(); ++y) {
+        const auto bucket = buckets_.find(getKey(x, y));
+        std::vector<Id>& bucketIds = bucket->second;
+        bucketIds.erase(std::find(bucketIds.begin(), bucketIds.end(), id));
+        if (bucketIds.empty()) buckets_.erase(bucket);
+      }
+    }
+  } else {
+    unbucketed_.erase(std::find(unbucketed_.begin(), unbucketed_.end(), id));
+  }
+  entry.isValid = false;
+  entry.polygon = Polygon();
+  freeIds_.push_back(id);
+  return true;
+}
+
+void PolygonIndex::clear()
+{
+  entries_.clear();
+  freeIds_.clear();
+  buckets_.clear();
+  unbucketed_.clear();
+}
+
+bool PolygonIndex::exists(const Id id) const
+{
+  return id < entries_.size() && entries_[id].isValid;
+}
+
+const Polygon& PolygonIndex::getPolygon(const Id id) const
+{
+  return entries_[id].polygon;
+}
+
+size_t PolygonIndex::size() const
+{
+  return entries_.size() - freeIds_.size();
+}
+
+double PolygonIndex::getBucketSize() const
+{
+  return bucketSize_;
+}
+
+size_t PolygonIndex::getMaxBucketsPerPolygon() const
+{
+  return maxBucketsPerPolygon_;
+}
+
+bool PolygonIndex::getContaining(const Position& point, std::vector<Id>& ids) const
+{
+  ids.clear();
+  const auto isContaining = [&](const Id id) {
+    const Entry& entry = entries_[id];
+    return (point.array() >= entry.boxMin).all() && (point.array() <= entry.boxMax).all()
+        && entry.polygon.isInside(point);
+  };
+
+  const auto bucket = buckets_.find(getKey(std::floor(point.x() / bucketSize_),
+                                           std::floor(point.y() / bucketSize_)));
+  if (bucket != buckets_.end()) {
+    for (const Id id : bucket->second) {
+      if (isContaining(id)) ids.push_back(id);
+    }
+  }
+  for (const Id id : unbucketed_) {
+    if (isContaining(id)) ids.push_back(id);
+  }
+  std::sort(ids.begin(), ids.end());
+  return !ids.empty();
+}
+
+bool PolygonIndex::getIntersecting(const Position& boxMin, const Position& boxMax,
+                                   std::vector<Id>& ids) const
+{
+  ids.clear();
+  const Eigen::Array2d min = boxMin.array(), max = boxMax.array();
+  Eigen::Array2i bucketMin, bucketMax;
+  getBucketRange(min, max, bucketMin, bucketMax);
+
+  // Collect the candidates of all buckets, polygons spanning several buckets show up
+  // more than once.
+  std::vector<Id> candidates(unbucketed_);
+  const double nBuckets = (bucketMax - bucketMin + 1).cast<double>().prod();
+  if (nBuckets <= buckets_.size()) {
+    for (int x = bucketMin.x(); x <= bucketMax.x(); ++x) {
+      for (int y = bucketMin.y(); y <= bucketMax.y(); ++y) {
+        const auto bucket = buckets_.find(getKey(x, y));
+        if (bucket == buckets_.end()) continue;
+        candidates.insert(candidates.end(), bucket->second.begin(), bucket->second.end());
+      }
+    }
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+  } else {
+    // Box larger than the occupied buckets, test all polygons.
+    candidates.clear();
+    for (Id id = 0; id < entries_.size(); ++id) {
+      if (entries_[id].isValid) candidates.push_back(id);
+    }
+  }
+
+  for (const Id id : candidates) {
+    const Entry& entry = entries_[id];
+    if ((entry.boxMin > max).any() || (entry.boxMax < min).any()) continue;
+    if (intersects(entry.polygon, min, max)) ids.push_back(id);
+  }
+  return !ids.empty();
+}
+
+void PolygonIndex::getBucketRange(const Eigen::Array2d& boxMin, const Eigen::Array2d& boxMax,
+                                  Eigen::Array2i& bucketMin, Eigen::Array2i& bucketMax) const
+{
+  bucketMin = (boxMin / bucketSize_).floor().cast<int>();
+  bucketMax = (boxMax / bucketSize_).floor().cast<int>();
+}
+
+int64_t PolygonIndex::getKey(const int x, const int y)
+{
+  return (static_cast<int64_t>(x) << 32) | static_cast<uint32_t>(y);
+}
+
+bool PolygonIndex::intersects(const Polygon& polygon, const Eigen::Array2d& boxMin,
+                              const Eigen::Array2d& boxMax)
+{
+  const std::vector<Position>& vertices = polygon.getVertices();
+  if (vertices.empty()) return false;
+
+  // An edge with a point in the box (clipped with Liang-Barsky).
+  for (size_t i = 0, j = vertices.size() - 1; i < vertices.size(); j = i++) {
+    const Eigen::Array2d start = vertices[j].array();
+    const Eigen::Array2d direction = vertices[i].array() - start;
+    double tMin = 0.0, tMax = 1.0;
+    bool isClipped = false;
+    for (int k = 0; k < 2 && !isClipped; ++k) {
+      if (direction(k) == 0.0) {
+        isClipped = start(k) < boxMin(k) || start(k) > boxMax(k);
+        continue;
+      }
+      double t0 = (boxMin(k) - start(k)) / direction(k);
+      double t1 = (boxMax(k) - start(k)) / direction(k);
+      if (t0 > t1) std::swap(t0, t1);
+      tMin = std::max(tMin, t0);
+      tMax = std::min(tMax, t1);
+      isClipped = tMin > tMax;
+    }
+    if (!isClipped) return true;
+  }
+
+  // Otherwise the box is either fully inside or fully outside of the polygon.
+  return polygon.isInside(Position(boxMin.x(), boxMin.y()));
+}
+
+} /* namespace grid_map */
@@ -0,0 +1,193 @@
+/*
+ * PolygonRasterizer.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map/PolygonRasterizer.hpp"
+#include "grid_map/GridMapMath.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace grid_map {
+
+namespace {
+
+//! Entry of the edge table. Stores the terms of the crossing test of `Polygon::isInside(...)`.
+struct Edge
+{
+  double xi, yi, dx, dy;
+  double yMin, yMax;
+
+  //! Intersection with the horizontal line through y (same expression as `Polygon::isInside(...)`).
+  double intersect(const double y) const
+  {
+    return dx * (y - yi) / dy + xi;
+  }
+};
+
+} // namespace
+
+PolygonRasterizer::PolygonRasterizer(const GridMap& gridMap)
+    : indexer_(gridMap.getIndexer())
+{
+}
+
+PolygonRasterizer::PolygonRasterizer(const GridIndexer& indexer)
+    : indexer_(indexer)
+{
+}
+
+const GridIndexer& PolygonRasterizer::getIndexer() const
+{
+  return indexer_;
+}
+
+Position PolygonRasterizer::getCellPosition(const Index& index) const
+{
+  Position position;
+  indexer_.getPositionFromIndex(position, indexer_.getBufferIndexFromIndex(index));
+  return position;
+}
+
+void PolygonRasterizer::getBoundingSubmap(const Polygon& polygon, Index& startIndex, Size& size) const
+{
+  Position topLeft = polygon.getVertices()[0];
+  Position bottomRight = topLeft;
+  for (const auto& vertex : polygon.getVertices()) {
+    topLeft = topLeft.array().max(vertex.array());
+    bottomRight = bottomRight.array().min(vertex.array());
+  }
+  boundPositionToRange(topLeft, indexer_.getLength(), indexer_.getPosition());
+  boundPositionToRange(bottomRight, indexer_.getLength(), indexer_.getPosition());
+  Index endIndex;
+  indexer_.getIndexFromPosition(startIndex, topLeft);
+  indexer_.getIndexFromPosition(endIndex, bottomRight);
+  size = getSubmapSizeFromCornerIndeces(startIndex, endIndex, indexer_.getSize(), indexer_.getStartIndex());
+  startIndex = indexer_.getIndexFromBufferIndex(startIndex);
+}
+
+void PolygonRasterizer::getUnwrappedSpans(const Polygon& polygon, std::vector<Span>& spans) const
+{
+  spans.clear();
+  const std::vector<Position>& vertices = polygon.getVertices();
+  if (vertices.size() < 3) return;
+
+  // Edge table, sorted by the upper end of the edges. Horizontal edges never cross a scanline.
+  std::vector<Edge> edges;
+  edges.reserve(vertices.size());
+  for (size_t i = 0, j = vertices.size() - 1; i < vertices.size(); j = i++) {
+    if (vertices[i].y() == vertices[j].y()) continue;
+    Edge edge;
+    edge.xi = vertices[i].x();
+    edge.yi = vertices[i].y();
+    edge.dx = vertices[j].x() - vertices[i].x();
+    edge.dy = vertices[j].y() - vertices[i].y();
+    edge.yMin = std::min(vertices[i].y(), vertices[j].y());
+    edge.yMax = std::max(vertices[i].y(), vertices[j].y());
+    edges.push_back(edge);
+  }
+  std::sort(edges.begin(), edges.end(), [](const Edge& a, const Edge& b) { return a.yMax > b.yMax; });
+
+  Index submapStart;
+  Size submapSize;
+  getBoundingSubmap(polygon, submapStart, submapSize);
+  if ((submapSize <= 0).any()) return;
+  const int rowBegin = submapStart(0);
+  const int rowEnd = submapStart(0) + submapSize(0);
+  const double resolution = indexer_.getResolution();
+  const double xFirstRow = getCellPosition(submapStart).x();
+
+  // First row in [rowBegin, rowEnd] whose cell center is left of x (cell centers decrease in x with the row).
+  auto getFirstRowBelow = [&](const int column, const double x) {
+    const double estimate = std::floor((xFirstRow - x) / resolution) + 1.0;
+    int row = rowBegin + static_cast<int>(std::max(0.0, std::min(estimate, static_cast<double>(submapSize(0)))));
+    while (row > rowBegin && getCellPosition(Index(row - 1, column)).x() < x) --row;
+    while (row < rowEnd && getCellPosition(Index(row, column)).x() >= x) ++row;
+    return row;
+  };
+
+  std::vector<const Edge*> activeEdges;
+  std::vector<double> intersections;
+  size_t nextEdge = 0;
+  for (int column = submapStart(1); column < submapStart(1) + submapSize(1); ++column) {
+    // Scanline through the cell centers of the column, decreasing in y with the column.
+    const double y = getCellPosition(Index(rowBegin, column)).y();
+    while (nextEdge < edges.size() && edges[nextEdge].yMax > y) {
+      activeEdges.push_back(&edges[nextEdge++]);
+    }
+    activeEdges.erase(std::remove_if(activeEdges.begin(), activeEdges.end(),
+                                     [y](const Edge* edge) { return edge->yMin > y; }), activeEdges.end());
+    if (activeEdges.empty()) {
+      if (nextEdge == edges.size()) break;
+      continue;
+    }
+
+    intersections.clear();
+    for (const auto edge : activeEdges) intersections.push_back(edge->intersect(y));
+    std::sort(intersections.begin(), intersections.end());
+
+    // A cell center is inside if an odd number of intersections lies right of it,
+    // i.e. within [x_2k, x_2k+1). Larger x are lower rows, list them in row order.
+    for (size_t k = intersections.size(); k >= 2; k -= 2) {
+      const int first = getFirstRowBelow(column, intersections[k - 1]);
+      const int last = getFirstRowBelow(column, intersections[k - 2]);
+      if (last > first) spans.emplace_back(column, first, last - first);
+    }
+  }
+}
+
+void PolygonRasterizer::getSpans(const Polygon& polygon, std::vector<Span>& spans) const
+{
+  std::vector<Span> unwrappedSpans;
+  getUnwrappedSpans(polygon, unwrappedSpans);
+  spans.clear();
+  spans.reserve(unwrappedSpans.size());
+  const int nRows = indexer_.getSize()(0);
+  for (const auto& span : unwrappedSpans) {
+    const Index start = indexer_.getBufferIndexFromIndex(span.getStartIndex());
+    const int firstLength = std::min(span.length, nRows - start(0));
+    spans.emplace_back(start(1), start(0), firstLength);
+    if (span.length > firstLength) spans.emplace_back(start(1), 0, span.length - firstLength);
+  }
+}
+
+void PolygonRasterizer::getRowSpans(const Polygon& polygon, std::vector<RowSpan>& rowSpans) const
+{
+  std::vector<Span> unwrappedSpans;
+  getUnwrappedSpans(polygon, unwrappedSpans);
+  rowSpans.clear();
+  if (unwrappedSpans.empty()) return;
+
+  // Counting sort of the cells by row. The columns of a row come out in increasing order.
+  int rowBegin = unwrappedSpans.front().rowStart;
+  int rowEnd = rowBegin;
+  for (const auto& span : unwrappedSpans) {
+    rowBegin = std::min(rowBegin, span.rowStart);
+    rowEnd = std::max(rowEnd, span.rowStart + span.length);
+  }
+  std::vector<int> rowOffsets(rowEnd - rowBegin + 1, 0);
+  for (const auto& span : unwrappedSpans) {
+    for (int row = span.rowStart; row < span.rowStart + span.length; ++row) ++rowOffsets[row - rowBegin + 1];
+  }
+  for (size_t i = 1; i < rowOffsets.size(); ++i) rowOffsets[i] += rowOffsets[i - 1];
+  std::vector<int> columns(rowOffsets.back());
+  std::vector<int> fill(rowOffsets.begin(), rowOffsets.end() - 1);
+  for (const auto& span : unwrappedSpans) {
+    for (int row = span.rowStart; row < span.rowStart + span.length; ++row) columns[fill[row - rowBegin]++] = span.column;
+  }
+
+  for (int row = rowBegin; row < rowEnd; ++row) {
+    const int begin = rowOffsets[row - rowBegin];
+    const int end = rowOffsets[row - rowBegin + 1];
+    for (int i = begin; i < end; ) {
+      int j = i + 1;
+      while (j < end && columns[j] == columns[j - 1] + 1) ++j;
+      rowSpans.emplace_back(row, columns[i], j - i);
+      i = j;
+    }
+  }
+}
+
+} /* namespace grid_map */
@@ -0,0 +1,123 @@
+/*
+ * RayCaster.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map/RayCaster.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace grid_map {
+
+RayCaster::RayCaster(const GridMap& gridMap, const RayTraversal traversal)
+    : indexer_(gridMap.getIndexer()),
+      traversal_(traversal),
+      nThreads_(1)
+{
+}
+
+void RayCaster::setNumberOfThreads(const unsigned int nThreads)
+{
+  nThreads_ = nThreads;
+}
+
+unsigned int RayCaster::getNumberOfThreads() const
+{
+  return nThreads_;
+}
+
+RayTraversal RayCaster::getTraversal() const
+{
+  return traversal_;
+}
+
+const GridIndexer& RayCaster::getIndexer() const
+{
+  return indexer_;
+}
+
+bool RayCaster::clipToMap(Eigen::Array2d& start, Eigen::Array2d& end) const
+{
+  // Liang-Barsky clipping against [0, size) in both index coordinates.
+  const Eigen::Array2d upper = indexer_.getSize().cast<double>() - 1e-9;
+  if ((upper < 0.0).any()) return false;
+  const Eigen::Array2d direction = end - start;
+  double tStart = 0.0, tEnd = 1.0;
+  for (int i = 0; i < 2; ++i) {
+    if (direction(i) == 0.0) {
+      if (start(i) < 0.0 || start(i) > upper(i)) return false;
+      continue;
+    }
+    double t0 = (0.0 - start(i)) / direction(i);
+    double t1 = (upper(i) - start(i)) / direction(i);
+    if (t0 > t1) std::swap(t0, t1);
+    tStart = std::max(tStart, t0);
+    tEnd = std::min(tEnd, t1);
+    if (tStart > tEnd) return false;
+  }
+  const Eigen::Array2d clippedStart = start + tStart * direction;
+  end = (start + tEnd * direction).max(0.0).min(upper);
+  start = clippedStart.max(0.0).min(upper);
+  return true;
+}
+
+bool RayCaster::getIndexLimitedToMap(const Position& start, const Position& end, Index& index) const
+{
+  Eigen::Array2d startCoordinates = indexer_.getIndexCoordinatesFromPosition(start);
+  if (!indexer_.isInside(start)) {
+    Eigen::Array2d entry = startCoordinates;
+    Eigen::Array2d exit = indexer_.getIndexCoordinatesFromPosition(end);
+    if (!clipToMap(entry, exit)) return false;
+    // Same steps of (almost) one cell as `LineIterator`, skipping those well before the entry into the map.
+    const double resolution = indexer_.getResolution();
+    const double stepLength = resolution - std::numeric_limits<double>::epsilon();
+    const Vector direction = (end - start).normalized();
+    const double entryDistance = (entry - startCoordinates).matrix().norm() * resolution;
+    const double nSkippedSteps = std::max(0.0, std::floor(entryDistance / stepLength) - 1.0);
+    Position position = start + nSkippedSteps * stepLength * direction;
+    while (!indexer_.isInside(position)) {
+      position += stepLength * direction;
+      if ((end - position).norm() < stepLength) return false;
+    }
+    startCoordinates = indexer_.getIndexCoordinatesFromPosition(position);
+  }
+  index = startCoordinates.floor().cast<int>();
+  return true;
+}
+
+void RayCaster::getMaxValues(const Matrix& data, const Position& origin, const std::vector<Position>& endpoints,
+                             std::vector<DataType>& maxValues) const
+{
+  maxValues.assign(endpoints.size(), 0);
+  castRays(origin, endpoints, [&](const size_t ray, const Index& index) {
+    maxValues[ray] = std::max(maxValues[ray], data(index(0), index(1)));
+    return true;
+  });
+}
+
+void RayCaster::getValueSums(const Matrix& data, const Position& origin, const std::vector<Position>& endpoints,
+                             std::vector<double>& sums) const
+{
+  sums.assign(endpoints.size(), 0.0);
+  castRays(origin, endpoints, [&](const size_t ray, const Index& index) {
+    sums[ray] += data(index(0), index(1));
+    return true;
+  });
+}
+
+size_t RayCaster::getFirstHits(const Matrix& data, const Position& origin, const std::vector<Position>& endpoints,
+                               const DataType threshold, std::vector<Index>& hits) const
+{
+  hits.assign(endpoints.size(), Index::Constant(-1));
+  castRays(origin, endpoints, [&](const size_t ray, const Index& index) {
+    if (data(index(0), index(1)) < threshold) return true;
+    hits[ray] = index;
+    return false;
+  });
+  return std::count_if(hits.begin(), hits.end(), [](const Index& hit) { return hit(0) >= 0; });
+}
+
+} /* namespace grid_map */
@@ -0,0 +1,92 @@
+/*
+ * RayTemplateCache.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map/RayTemplateCache.hpp"
+
+#include <cmath>
+
+namespace grid_map {
+
+RayTemplateCache::RayTemplateCache(const std::vector<double>& angles, const double maxRange)
+    : angles_(angles),
+      maxRange_(maxRange),
+      resolution_(0.0)
+{
+}
+
+bool RayTemplateCache::update(const double resolution)
+{
+  if (resolution == resolution_) return false;
+  resolution_ = resolution;
+  offsets_.clear();
+  distances_.clear();
+  rayStarts_.assign(1, 0);
+
+  for (const double angle : angles_) {
+    // The index axes point in negative x/y direction. From a cell center, the end cell
+    // of the beam is the rounded offset.
+    const Vector direction(std::cos(angle), std::sin(angle));
+    const Eigen::Array2d endCoordinates = -(maxRange_ / resolution_) * direction.array();
+    const Index end((endCoordinates + 0.5).floor().cast<int>());
+
+    // Same stepping as `LineIterator`.
+    const Size delta = end.abs();
+    const Index step((end(0) >= 0) ? 1 : -1, (end(1) >= 0) ? 1 : -1);
+    const int major = (delta(0) >= delta(1)) ? 0 : 1;
+    const int minor = 1 - major;
+    int numerator = delta(major) / 2;
+    Index offset = Index::Zero();
+    for (int i = 0; i <= delta(major); ++i) {
+      offsets_.push_back(offset);
+      distances_.push_back(-resolution_ * offset.cast<double>().matrix().dot(direction));
+      numerator += delta(minor);
+      if (numerator >= delta(major)) {
+        numerator -= delta(major);
+        offset(minor) += step(minor);
+      }
+      offset(major) += step(major);
+    }
+    rayStarts_.push_back(offsets_.size());
+  }
+  return true;
+}
+
+double RayTemplateCache::getResolution() const
+{
+  return resolution_;
+}
+
+double RayTemplateCache::getMaxRange() const
+{
+  return maxRange_;
+}
+
+size_t RayTemplateCache::getNumberOfBeams() const
+{
+  return angles_.size();
+}
+
+double RayTemplateCache::getAngle(const size_t beam) const
+{
+  return angles_[beam];
+}
+
+size_t RayTemplateCache::getRaySize(const size_t beam) const
+{
+  return rayStarts_[beam + 1] - rayStarts_[beam];
+}
+
+const Index* RayTemplateCache::getRayOffsets(const size_t beam) const
+{
+  return offsets_.data() + rayStarts_[beam];
+}
+
+const float* RayTemplateCache::getRayDistances(const size_t beam) const
+{
+  return distances_.data() + rayStarts_[beam];
+}
+
+} /* namespace grid_map */
@@ -0,0 +1,83 @@
+/*
+ * RingOffsetTable.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map/RingOffsetTable.hpp"
+
+#include <mutex>
+
+namespace grid_map {
+
+namespace {
+
+int signum(const int val)
+{
+  return (0 < val) - (val < 0);
+}
+
+} // namespace
+
+constexpr unsigned int RingOffsetTable::maxCachedRings;
+
+std::shared_ptr<const RingOffsetTable> RingOffsetTable::get(const unsigned int nRings)
+{
+  static std::mutex mutex;
+  static std::shared_ptr<const RingOffsetTable> cachedTable;
+  std::lock_guard<std::mutex> lock(mutex);
+  if (!cachedTable || cachedTable->getNumberOfRings() < nRings) {
+    if (nRings > maxCachedRings) {
+      if (!cachedTable || cachedTable->getNumberOfRings() < maxCachedRings) {
+        cachedTable.reset(new RingOffsetTable(maxCachedRings, cachedTable.get()));
+      }
+      return std::shared_ptr<const RingOffsetTable>(new RingOffsetTable(nRings, cachedTable.get()));
+    }
+    cachedTable.reset(new RingOffsetTable(nRings, cachedTable.get()));
+  }
+  return cachedTable;
+}
+
+RingOffsetTable::RingOffsetTable(const unsigned int nRings, const RingOffsetTable* base)
+{
+  unsigned int ring = 0;
+  if (base != nullptr) {
+    offsets_ = base->offsets_;
+    ringStarts_ = base->ringStarts_;
+    ringStarts_.pop_back();
+    ring = base->getNumberOfRings() + 1;
+  }
+  for (; ring <= nRings; ++ring) {
+    ringStarts_.push_back(offsets_.size());
+    generateRing(ring);
+  }
+  ringStarts_.push_back(offsets_.size());
+}
+
+void RingOffsetTable::generateRing(const unsigned int ring)
+{
+  if (ring == 0) {
+    offsets_.push_back(Index::Zero());
+    return;
+  }
+  const int distance = ring;
+  Index point(distance, 0);
+  Index normal;
+  do {
+    offsets_.push_back(point);
+    normal.x() = -signum(point.y());
+    normal.y() = signum(point.x());
+    if (normal.x() != 0
+        && (int) Vector(point.x() + normal.x(), point.y()).norm() == distance)
+      point.x() += normal.x();
+    else if (normal.y() != 0
+        && (int) Vector(point.x(), point.y() + normal.y()).norm() == distance)
+      point.y() += normal.y();
+    else {
+      point.x() += normal.x();
+      point.y() += normal.y();
+    }
+  } while (point.x() != distance || point.y() != 0);
+}
+
+} /* namespace grid_map */
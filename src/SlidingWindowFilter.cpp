@@ -0,0 +1,196 @@
+/*
+ * SlidingWindowFilter.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map/SlidingWindowFilter.hpp"
+#include "grid_map/BufferRegion.hpp"
+#include "grid_map/GridMapMath.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+namespace grid_map {
+
+namespace {
+
+/*!
+ * Sliding minimum/maximum over a (strided) sequence with a monotonic deque. The
+ * sequence is stored circularly and starts at `offset`, the windows are cropped at
+ * the ends of the sequence (and not wrapped around the seam of the buffer).
+ */
+template<typename Compare>
+void slidingExtremum(const DataType* input, DataType* output, const Eigen::Index stride, const int n,
+                     const int offset, const int margin, const Compare& compare, std::vector<int>& deque)
+{
+  const auto wrap = [n](const int k) { return k < n ? k : k - n; };
+  deque.resize(n);
+  int head = 0, tail = 0, next = 0;
+  for (int i = 0; i < n; ++i) {
+    for (const int last = std::min(i + margin, n - 1); next <= last; ++next) {
+      const DataType value = input[wrap(next + offset) * stride];
+      while (tail > head && !compare(input[wrap(deque[tail - 1] + offset) * stride], value)) --tail;
+      deque[tail++] = next;
+    }
+    while (deque[head] < i - margin) ++head;
+    output[wrap(i + offset) * stride] = input[wrap(deque[head] + offset) * stride];
+  }
+}
+
+/*!
+ * Sliding sum over a contiguous, circularly stored sequence starting at `offset`,
+ * cropped at the ends of the sequence.
+ */
+void slidingSum(const DataType* input, double* output, const int n, const int offset, const int margin)
+{
+  const auto wrap = [n](const int k) { return k < n ? k : k - n; };
+  double sum = 0.0;
+  int next = 0;
+  for (int i = 0; i < n; ++i) {
+    for (const int last = std::min(i + margin, n - 1); next <= last; ++next) sum += input[wrap(next + offset)];
+    if (i - margin - 1 >= 0) sum -= input[wrap(i - margin - 1 + offset)];
+    output[wrap(i + offset)] = sum;
+  }
+}
+
+/*!
+ * Number of cells of a window cropped to a sequence.
+ */
+inline int getCroppedLength(const int i, const int n, const int margin)
+{
+  return std::min(i + margin, n - 1) - std::max(i - margin, 0) + 1;
+}
+
+template<typename Scalar>
+DataType toDataType(const Scalar value)
+{
+  const double max = std::numeric_limits<DataType>::max();
+  const double lowest = std::numeric_limits<DataType>::lowest();
+  if (std::is_integral<DataType>::value) return static_cast<DataType>(std::max(lowest, std::min(max, std::round(value))));
+  return static_cast<DataType>(value);
+}
+
+} // namespace
+
+SlidingWindowFilter::SlidingWindowFilter(const size_t windowSize, const EdgeHandling& edgeHandling)
+    : windowSize_(windowSize),
+      edgeHandling_(edgeHandling)
+{
+  if (windowSize_ % 2 == 0) throw std::runtime_error("SlidingWindowFilter has a wrong window size!");
+  windowMargin_ = (windowSize_ - 1) / 2;
+}
+
+void SlidingWindowFilter::setWindowLength(const GridMap& gridMap, const double windowLength)
+{
+  windowSize_ = std::round(windowLength / gridMap.getResolution());
+  if (windowSize_ % 2 != 1) ++windowSize_;
+  windowMargin_ = (windowSize_ - 1) / 2;
+}
+
+size_t SlidingWindowFilter::getWindowSize() const
+{
+  return windowSize_;
+}
+
+void SlidingWindowFilter::filter(GridMap& gridMap, const std::string& layer, const std::string& destinationLayer,
+                                 const Statistic statistic)
+{
+  const Matrix& data = gridMap.get(layer);
+  if (!gridMap.exists(destinationLayer)) gridMap.add(destinationLayer, data);
+  filter(gridMap.get(layer), gridMap.get(destinationLayer), statistic, gridMap.getStartIndex());
+}
+
+void SlidingWindowFilter::filter(const Matrix& data, Matrix& result, const Statistic statistic,
+                                 const Index& bufferStartIndex)
+{
+  const int nRows = data.rows();
+  const int nCols = data.cols();
+  resultBuffer_.resize(nRows, nCols);
+  if (nRows == 0 || nCols == 0) return;
+  const Size bufferSize(nRows, nCols);
+  const int rowOffset = bufferStartIndex(0);
+  const int colOffset = bufferStartIndex(1);
+
+  switch (statistic) {
+    case Statistic::MIN:
+    case Statistic::MAX: {
+      // Rows pass along the contiguous columns, then columns pass across the columns.
+      extremumBuffer_.resize(nRows, nCols);
+      for (int j = 0; j < nCols; ++j) {
+        if (statistic == Statistic::MIN) {
+          slidingExtremum(&data(0, j), &extremumBuffer_(0, j), 1, nRows, rowOffset, windowMargin_, std::less<DataType>(), deque_);
+        } else {
+          slidingExtremum(&data(0, j), &extremumBuffer_(0, j), 1, nRows, rowOffset, windowMargin_, std::greater<DataType>(), deque_);
+        }
+      }
+      for (int i = 0; i < nRows; ++i) {
+        if (statistic == Statistic::MIN) {
+          slidingExtremum(&extremumBuffer_(i, 0), &resultBuffer_(i, 0), nRows, nCols, colOffset, windowMargin_, std::less<DataType>(), deque_);
+        } else {
+          slidingExtremum(&extremumBuffer_(i, 0), &resultBuffer_(i, 0), nRows, nCols, colOffset, windowMargin_, std::greater<DataType>(), deque_);
+        }
+      }
+      break;
+    }
+    case Statistic::MEAN: {
+      sumBuffer_.resize(nRows, nCols);
+      for (int j = 0; j < nCols; ++j) slidingSum(&data(0, j), &sumBuffer_(0, j), nRows, rowOffset, windowMargin_);
+      Eigen::VectorXd rowCounts(nRows);
+      for (int i = 0; i < nRows; ++i) {
+        rowCounts(i) = getCroppedLength(getIndexFromBufferIndex(Index(i, 0), bufferSize, bufferStartIndex)(0),
+                                        nRows, windowMargin_);
+      }
+      // Columns in unwrapped order, the running sum over columns is vectorized along the rows.
+      const auto bufferColumn = [nCols, colOffset](const int j) { return (j + colOffset) % nCols; };
+      columnSum_.setZero(nRows);
+      int next = 0;
+      for (int j = 0; j < nCols; ++j) {
+        for (const int last = std::min(j + windowMargin_, nCols - 1); next <= last; ++next) columnSum_ += sumBuffer_.col(bufferColumn(next));
+        if (j - windowMargin_ - 1 >= 0) columnSum_ -= sumBuffer_.col(bufferColumn(j - windowMargin_ - 1));
+        const double columnCount = getCroppedLength(j, nCols, windowMargin_);
+        const int column = bufferColumn(j);
+        for (int i = 0; i < nRows; ++i) resultBuffer_(i, column) = toDataType(columnSum_(i) / (rowCounts(i) * columnCount));
+      }
+      break;
+    }
+    case Statistic::COUNT: {
+      for (int j = 0; j < nCols; ++j) {
+        for (int i = 0; i < nRows; ++i) {
+          const Index index(getIndexFromBufferIndex(Index(i, j), bufferSize, bufferStartIndex));
+          const double count = (edgeHandling_ == EdgeHandling::MEAN) ? windowSize_ * windowSize_
+              : getCroppedLength(index(0), nRows, windowMargin_) * getCroppedLength(index(1), nCols, windowMargin_);
+          resultBuffer_(i, j) = toDataType(count);
+        }
+      }
+      break;
+    }
+  }
+  writeResult(result, bufferStartIndex);
+}
+
+void SlidingWindowFilter::writeResult(Matrix& result, const Index& bufferStartIndex) const
+{
+  if (edgeHandling_ != EdgeHandling::INSIDE) {
+    result = resultBuffer_;
+    return;
+  }
+  // Copy the cells with a full window, split at the seams of the circular buffer.
+  const Size bufferSize(resultBuffer_.rows(), resultBuffer_.cols());
+  const Size insideSize(bufferSize - 2 * windowMargin_);
+  if ((insideSize <= 0).any()) return;
+  const Index insideStartIndex(getBufferIndexFromIndex(Index::Constant(windowMargin_), bufferSize, bufferStartIndex));
+  std::vector<BufferRegion> bufferRegions;
+  getBufferRegionsForSubmap(bufferRegions, insideStartIndex, insideSize, bufferSize, bufferStartIndex);
+  for (const auto& bufferRegion : bufferRegions) {
+    const Index& index = bufferRegion.getStartIndex();
+    const Size& size = bufferRegion.getSize();
+    result.block(index(0), index(1), size(0), size(1)) = resultBuffer_.block(index(0), index(1), size(0), size(1));
+  }
+}
+
+} /* namespace grid_map */
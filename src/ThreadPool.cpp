@@ -0,0 +1,117 @@
+/*
+ * ThreadPool.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map/ThreadPool.hpp"
+#include "grid_map/Parallel.hpp"
+
+namespace grid_map {
+
+namespace {
+
+//! True on the worker threads of all pools and on a thread while it takes part in a batch.
+thread_local bool isInsidePool = false;
+
+/*!
+ * Marks the calling thread as inside a pool while the guard exists.
+ */
+class InsidePoolGuard
+{
+ public:
+  InsidePoolGuard() : wasInsidePool_(isInsidePool) { isInsidePool = true; }
+  ~InsidePoolGuard() { isInsidePool = wasInsidePool_; }
+
+ private:
+  bool wasInsidePool_;
+};
+
+} // namespace
+
+ThreadPool::ThreadPool(const unsigned int nThreads)
+    : function_(nullptr),
+      nTasks_(0),
+      nextTask_(0),
+      generation_(0),
+      nActiveWorkers_(0),
+      isStopping_(false)
+{
+  const unsigned int nWorkers = resolveNumberOfThreads(nThreads) - 1;
+  threads_.reserve(nWorkers);
+  for (unsigned int i = 0; i < nWorkers; ++i) threads_.emplace_back(&ThreadPool::work, this, i + 1);
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    isStopping_ = true;
+  }
+  startCondition_.notify_all();
+  for (auto& thread : threads_) thread.join();
+}
+
+unsigned int ThreadPool::getNumberOfThreads() const
+{
+  return threads_.size() + 1;
+}
+
+void ThreadPool::run(const size_t nTasks, const std::function<void(size_t, unsigned int)>& function)
+{
+  if (nTasks == 0) return;
+  // A nested call from within a task must not lock the run mutex, which the calling
+  // thread may already own.
+  std::unique_lock<std::mutex> runLock(runMutex_, std::defer_lock);
+  if (isInsidePool || threads_.empty() || nTasks == 1 || !runLock.try_lock()) {
+    for (size_t task = 0; task < nTasks; ++task) function(task, 0);
+    return;
+  }
+  const InsidePoolGuard insidePoolGuard;
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    function_ = &function;
+    nTasks_ = nTasks;
+    nextTask_ = 0;
+    nActiveWorkers_ = threads_.size();
+    ++generation_;
+  }
+  startCondition_.notify_all();
+  for (size_t task = nextTask_++; task < nTasks; task = nextTask_++) function(task, 0);
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  doneCondition_.wait(lock, [this]() { return nActiveWorkers_ == 0; });
+  function_ = nullptr;
+}
+
+ThreadPool& ThreadPool::getGlobalPool()
+{
+  static ThreadPool threadPool;
+  return threadPool;
+}
+
+void ThreadPool::work(const unsigned int thread)
+{
+  const InsidePoolGuard insidePoolGuard;
+  size_t generation = 0;
+  while (true) {
+    const std::function<void(size_t, unsigned int)>* function;
+    size_t nTasks;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      startCondition_.wait(lock, [this, generation]() { return isStopping_ || generation_ != generation; });
+      if (isStopping_) return;
+      generation = generation_;
+      function = function_;
+      nTasks = nTasks_;
+    }
+    for (size_t task = nextTask_++; task < nTasks; task = nextTask_++) (*function)(task, thread);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (--nActiveWorkers_ == 0) doneCondition_.notify_one();
+    }
+  }
+}
+
+} /* namespace grid_map */
@@ -15,82 +15,118 @@ namespace grid_map {
 
 CircleIterator::CircleIterator(const GridMap& gridMap, const Position& center, const double radius)
     : center_(center),
-      radius_(radius)
+      radius_(radius),
+      indexer_(gridMap.getIndexer())
 {
   radiusSquare_ = pow(radius_, 2);
-  mapLength_ = gridMap.getLength();
-  mapPosition_ = gridMap.getPosition();
-  resolution_ = gridMap.getResolution();
-  bufferSize_ = gridMap.getSize();
-  bufferStartIndex_ = gridMap.getStartIndex();
   Index submapStartIndex;
-  Index submapBufferSize;
-  findSubmapParameters(center, radius, submapStartIndex, submapBufferSize);
-  internalIterator_ = std::shared_ptr<SubmapIterator>(new SubmapIterator(gridMap, submapStartIndex, submapBufferSize));
-  if(!isInside()) ++(*this);
-}
-
-CircleIterator& CircleIterator::operator =(const CircleIterator& other)
-{
-  center_ = other.center_;
-  radius_ = other.radius_;
-  radiusSquare_ = other.radiusSquare_;
-  internalIterator_ = other.internalIterator_;
-  mapLength_ = other.mapLength_;
-  mapPosition_ = other.mapPosition_;
-  resolution_ = other.resolution_;
-  bufferSize_ = other.bufferSize_;
-  bufferStartIndex_ = other.bufferStartIndex_;
-  return *this;
+  findSubmapParameters(center, radius, submapStartIndex, submapSize_);
+  submapStartIndex_ = indexer_.getIndexFromBufferIndex(submapStartIndex);
+  row_ = column_ = columnEnd_ = 0;
+  index_.setZero();
+  findNextRow(submapStartIndex_(0));
 }
 
 bool CircleIterator::operator !=(const CircleIterator& other) const
 {
-  return (internalIterator_ != other.internalIterator_);
+  return (index_ != other.index_).any();
 }
 
 const Index& CircleIterator::operator *() const
 {
-  return *(*internalIterator_);
+  return index_;
 }
 
 CircleIterator& CircleIterator::operator ++()
 {
-  ++(*internalIterator_);
-  if (internalIterator_->isPastEnd()) return *this;
-
-  for ( ; !internalIterator_->isPastEnd(); ++(*internalIterator_)) {
-    if (isInside()) break;
+  if (isPastEnd_) return *this;
+  if (++column_ < columnEnd_) {
+    if (++index_(1) == indexer_.getSize()(1)) index_(1) = 0;
+    return *this;
   }
-
+  findNextRow(row_ + 1);
   return *this;
 }
 
 bool CircleIterator::isPastEnd() const
 {
-  return internalIterator_->isPastEnd();
+  return isPastEnd_;
 }
 
-bool CircleIterator::isInside() const
+void CircleIterator::getSpans(std::vector<Span>& spans) const
 {
-  Position position;
-  getPositionFromIndex(position, *(*internalIterator_), mapLength_, mapPosition_, resolution_, bufferSize_, bufferStartIndex_);
+  spans.clear();
+  for (int column = submapStartIndex_(1); column < submapStartIndex_(1) + submapSize_(1); ++column) {
+    int begin, end;
+    if (!getColumnInterval(column, begin, end)) continue;
+    const Index start = indexer_.getBufferIndexFromIndex(Index(begin, column));
+    const int length = end - begin;
+    const int firstLength = std::min(length, indexer_.getSize()(0) - start(0));
+    spans.emplace_back(start(1), start(0), firstLength);
+    if (length > firstLength) spans.emplace_back(start(1), 0, length - firstLength);
+  }
+}
+
+bool CircleIterator::isInside(const Index& index) const
+{
+  const Position position = indexer_.getFirstCellPosition()
+      - (indexer_.getResolution() * index.cast<double>()).matrix();
   double squareNorm = (position - center_).array().square().sum();
   return (squareNorm <= radiusSquare_);
 }
 
+bool CircleIterator::getRowInterval(const int row, int& begin, int& end) const
+{
+  // Solve |y - center.y| <= sqrt(r^2 - dx^2) for the cell centers y = firstCell.y - resolution * column.
+  const double resolution = indexer_.getResolution();
+  const Position& firstCellPosition = indexer_.getFirstCellPosition();
+  const double dx = firstCellPosition.x() - resolution * row - center_.x();
+  const double discriminant = radiusSquare_ - dx * dx;
+  if (discriminant < -1e-9 * radiusSquare_) return false;
+  const double halfChord = std::sqrt(std::max(discriminant, 0.0));
+  const double offset = firstCellPosition.y() - center_.y();
+  return refineInterval((offset - halfChord) / resolution, (offset + halfChord) / resolution,
+                        submapStartIndex_(1), submapStartIndex_(1) + submapSize_(1),
+                        [this, row](const int column) { return isInside(Index(row, column)); }, begin, end);
+}
+
+bool CircleIterator::getColumnInterval(const int column, int& begin, int& end) const
+{
+  const double resolution = indexer_.getResolution();
+  const Position& firstCellPosition = indexer_.getFirstCellPosition();
+  const double dy = firstCellPosition.y() - resolution * column - center_.y();
+  const double discriminant = radiusSquare_ - dy * dy;
+  if (discriminant < -1e-9 * radiusSquare_) return false;
+  const double halfChord = std::sqrt(std::max(discriminant, 0.0));
+  const double offset = firstCellPosition.x() - center_.x();
+  return refineInterval((offset - halfChord) / resolution, (offset + halfChord) / resolution,
+                        submapStartIndex_(0), submapStartIndex_(0) + submapSize_(0),
+                        [this, column](const int row) { return isInside(Index(row, column)); }, begin, end);
+}
+
+void CircleIterator::findNextRow(int row)
+{
+  for (; row < submapStartIndex_(0) + submapSize_(0); ++row) {
+    if (!getRowInterval(row, column_, columnEnd_)) continue;
+    row_ = row;
+    index_ = indexer_.getBufferIndexFromIndex(Index(row_, column_));
+    isPastEnd_ = false;
+    return;
+  }
+  isPastEnd_ = true;
+}
+
 void CircleIterator::findSubmapParameters(const Position& center, const double radius,
                                           Index& startIndex, Size& bufferSize) const
 {
   Position topLeft = center.array() + radius;
   Position bottomRight = center.array() - radius;
-  boundPositionToRange(topLeft, mapLength_, mapPosition_);
-  boundPositionToRange(bottomRight, mapLength_, mapPosition_);
-  getIndexFromPosition(startIndex, topLeft, mapLength_, mapPosition_, resolution_, bufferSize_, bufferStartIndex_);
+  boundPositionToRange(topLeft, indexer_.getLength(), indexer_.getPosition());
+  boundPositionToRange(bottomRight, indexer_.getLength(), indexer_.getPosition());
+  indexer_.getIndexFromPosition(startIndex, topLeft);
   Index endIndex;
-  getIndexFromPosition(endIndex, bottomRight, mapLength_, mapPosition_, resolution_, bufferSize_, bufferStartIndex_);
-  bufferSize = getSubmapSizeFromCornerIndeces(startIndex, endIndex, bufferSize_, bufferStartIndex_);
+  indexer_.getIndexFromPosition(endIndex, bottomRight);
+  bufferSize = getSubmapSizeFromCornerIndeces(startIndex, endIndex, indexer_.getSize(), indexer_.getStartIndex());
 }
 
 } /* namespace grid_map */
-
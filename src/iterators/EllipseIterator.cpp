@@ -17,78 +17,113 @@ using namespace std;
 namespace grid_map {
 
 EllipseIterator::EllipseIterator(const GridMap& gridMap, const Position& center, const Length& length, const double rotation)
-    : center_(center)
+    : center_(center),
+      indexer_(gridMap.getIndexer())
 {
   semiAxisSquare_ = (0.5 * length).square();
   double sinRotation = sin(rotation);
   double cosRotation = cos(rotation);
   transformMatrix_ << cosRotation, sinRotation, sinRotation, -cosRotation;
-  mapLength_ = gridMap.getLength();
-  mapPosition_ = gridMap.getPosition();
-  resolution_ = gridMap.getResolution();
-  bufferSize_ = gridMap.getSize();
-  bufferStartIndex_ = gridMap.getStartIndex();
+  quadraticForm_ = transformMatrix_.transpose() * semiAxisSquare_.inverse().matrix().asDiagonal() * transformMatrix_;
   Index submapStartIndex;
-  Index submapBufferSize;
-  findSubmapParameters(center, length, rotation, submapStartIndex, submapBufferSize);
-  internalIterator_ = std::shared_ptr<SubmapIterator>(new SubmapIterator(gridMap, submapStartIndex, submapBufferSize));
-  if(!isInside()) ++(*this);
-}
-
-EllipseIterator& EllipseIterator::operator =(const EllipseIterator& other)
-{
-  center_ = other.center_;
-  semiAxisSquare_ = other.semiAxisSquare_;
-  transformMatrix_ = other.transformMatrix_;
-  internalIterator_ = other.internalIterator_;
-  mapLength_ = other.mapLength_;
-  mapPosition_ = other.mapPosition_;
-  resolution_ = other.resolution_;
-  bufferSize_ = other.bufferSize_;
-  bufferStartIndex_ = other.bufferStartIndex_;
-  return *this;
+  findSubmapParameters(center, length, rotation, submapStartIndex, submapSize_);
+  submapStartIndex_ = indexer_.getIndexFromBufferIndex(submapStartIndex);
+  row_ = column_ = columnEnd_ = 0;
+  index_.setZero();
+  findNextRow(submapStartIndex_(0));
 }
 
 bool EllipseIterator::operator !=(const EllipseIterator& other) const
 {
-  return (internalIterator_ != other.internalIterator_);
+  return (index_ != other.index_).any();
 }
 
 const Eigen::Array2i& EllipseIterator::operator *() const
 {
-  return *(*internalIterator_);
+  return index_;
 }
 
 EllipseIterator& EllipseIterator::operator ++()
 {
-  ++(*internalIterator_);
-  if (internalIterator_->isPastEnd()) return *this;
-
-  for ( ; !internalIterator_->isPastEnd(); ++(*internalIterator_)) {
-    if (isInside()) break;
+  if (isPastEnd_) return *this;
+  if (++column_ < columnEnd_) {
+    if (++index_(1) == indexer_.getSize()(1)) index_(1) = 0;
+    return *this;
   }
-
+  findNextRow(row_ + 1);
   return *this;
 }
 
 bool EllipseIterator::isPastEnd() const
 {
-  return internalIterator_->isPastEnd();
+  return isPastEnd_;
 }
 
 const Size& EllipseIterator::getSubmapSize() const
 {
-  return internalIterator_->getSubmapSize();
+  return submapSize_;
 }
 
-bool EllipseIterator::isInside() const
+void EllipseIterator::getSpans(std::vector<Span>& spans) const
 {
-  Position position;
-  getPositionFromIndex(position, *(*internalIterator_), mapLength_, mapPosition_, resolution_, bufferSize_, bufferStartIndex_);
+  spans.clear();
+  for (int column = submapStartIndex_(1); column < submapStartIndex_(1) + submapSize_(1); ++column) {
+    int begin, end;
+    if (!getInterval(1, column, begin, end)) continue;
+    const Index start = indexer_.getBufferIndexFromIndex(Index(begin, column));
+    const int length = end - begin;
+    const int firstLength = std::min(length, indexer_.getSize()(0) - start(0));
+    spans.emplace_back(start(1), start(0), firstLength);
+    if (length > firstLength) spans.emplace_back(start(1), 0, length - firstLength);
+  }
+}
+
+bool EllipseIterator::isInside(const Index& index) const
+{
+  const Position position = indexer_.getFirstCellPosition()
+      - (indexer_.getResolution() * index.cast<double>()).matrix();
   double value = ((transformMatrix_ * (position - center_)).array().square() / semiAxisSquare_).sum();
   return (value <= 1);
 }
 
+bool EllipseIterator::getInterval(const int dimension, const int line, int& begin, int& end) const
+{
+  // With the offset d of the fixed coordinate, the ellipse equation is a quadratic
+  // a * t^2 + b * t + c <= 0 in the offset t along the line.
+  const int other = 1 - dimension;
+  const double resolution = indexer_.getResolution();
+  const Position& firstCellPosition = indexer_.getFirstCellPosition();
+  const double d = firstCellPosition(dimension) - resolution * line - center_(dimension);
+  const double a = quadraticForm_(other, other);
+  const double b = 2.0 * quadraticForm_(0, 1) * d;
+  const double c = quadraticForm_(dimension, dimension) * d * d - 1.0;
+  const double discriminant = b * b - 4.0 * a * c;
+  if (discriminant < -1e-9 * (b * b + std::abs(4.0 * a * c))) return false;
+  const double root = std::sqrt(std::max(discriminant, 0.0));
+  const double tMin = (-b - root) / (2.0 * a);
+  const double tMax = (-b + root) / (2.0 * a);
+
+  // Cell centers along the line are at firstCell - resolution * k.
+  const double offset = firstCellPosition(other) - center_(other);
+  return refineInterval((offset - tMax) / resolution, (offset - tMin) / resolution,
+                        submapStartIndex_(other), submapStartIndex_(other) + submapSize_(other),
+                        [this, dimension, line](const int k) {
+                          return isInside(dimension == 0 ? Index(line, k) : Index(k, line));
+                        }, begin, end);
+}
+
+void EllipseIterator::findNextRow(int row)
+{
+  for (; row < submapStartIndex_(0) + submapSize_(0); ++row) {
+    if (!getInterval(0, row, column_, columnEnd_)) continue;
+    row_ = row;
+    index_ = indexer_.getBufferIndexFromIndex(Index(row_, column_));
+    isPastEnd_ = false;
+    return;
+  }
+  isPastEnd_ = true;
+}
+
 void EllipseIterator::findSubmapParameters(const Position& center, const Length& length, const double rotation,
                                            Index& startIndex, Size& bufferSize) const
 {
@@ -98,12 +133,12 @@ void EllipseIterator::findSubmapParameters(const Position& center, const Length&
   const Length boundingBoxHalfLength = (u.cwiseAbs2() + v.cwiseAbs2()).array().sqrt();
   Position topLeft = center.array() + boundingBoxHalfLength;
   Position bottomRight = center.array() - boundingBoxHalfLength;
-  boundPositionToRange(topLeft, mapLength_, mapPosition_);
-  boundPositionToRange(bottomRight, mapLength_, mapPosition_);
-  getIndexFromPosition(startIndex, topLeft, mapLength_, mapPosition_, resolution_, bufferSize_, bufferStartIndex_);
+  boundPositionToRange(topLeft, indexer_.getLength(), indexer_.getPosition());
+  boundPositionToRange(bottomRight, indexer_.getLength(), indexer_.getPosition());
+  indexer_.getIndexFromPosition(startIndex, topLeft);
   Index endIndex;
-  getIndexFromPosition(endIndex, bottomRight, mapLength_, mapPosition_, resolution_, bufferSize_, bufferStartIndex_);
-  bufferSize = getSubmapSizeFromCornerIndeces(startIndex, endIndex, bufferSize_, bufferStartIndex_);
+  indexer_.getIndexFromPosition(endIndex, bottomRight);
+  bufferSize = getSubmapSizeFromCornerIndeces(startIndex, endIndex, indexer_.getSize(), indexer_.getStartIndex());
 }
 
 } /* namespace grid_map */
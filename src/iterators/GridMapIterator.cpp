@@ -16,6 +16,7 @@ GridMapIterator::GridMapIterator(const grid_map::GridMap& gridMap)
   size_ = gridMap.getSize();
   startIndex_ = gridMap.getStartIndex();
   linearSize_ = size_.prod();
+  rowShift_ = isPowerOfTwo(size_(0)) ? getPowerOfTwoExponent(size_(0)) : -1;
   linearIndex_ = 0;
   isPastEnd_ = false;
 }
@@ -25,6 +26,7 @@ GridMapIterator::GridMapIterator(const GridMapIterator* other)
   size_ = other->size_;
   startIndex_ = other->startIndex_;
   linearSize_ = other->linearSize_;
+  rowShift_ = other->rowShift_;
   linearIndex_ = other->linearIndex_;
   isPastEnd_ = other->isPastEnd_;
 }
@@ -34,6 +36,7 @@ GridMapIterator& GridMapIterator::operator =(const GridMapIterator& other)
   size_ = other.size_;
   startIndex_ = other.startIndex_;
   linearSize_ = other.linearSize_;
+  rowShift_ = other.rowShift_;
   linearIndex_ = other.linearIndex_;
   isPastEnd_ = other.isPastEnd_;
   return *this;
@@ -46,6 +49,9 @@ bool GridMapIterator::operator !=(const GridMapIterator& other) const
 
 const Index GridMapIterator::operator *() const
 {
+  if (rowShift_ >= 0) {
+    return Index(static_cast<int>(linearIndex_ & (size_(0) - 1)), static_cast<int>(linearIndex_ >> rowShift_));
+  }
   return getIndexFromLinearIndex(linearIndex_, size_);
 }
 
@@ -82,4 +88,13 @@ bool GridMapIterator::isPastEnd() const
   return isPastEnd_;
 }
 
+void GridMapIterator::getSpans(std::vector<Span>& spans) const
+{
+  spans.clear();
+  spans.reserve(size_(1));
+  for (int column = 0; column < size_(1); ++column) {
+    spans.emplace_back(column, 0, size_(0));
+  }
+}
+
 } /* namespace grid_map */
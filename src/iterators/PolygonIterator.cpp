@@ -9,86 +9,197 @@
 #include "grid_map/iterators/PolygonIterator.hpp"
 #include "grid_map/GridMapMath.hpp"
 
+#include <algorithm>
+#include <cmath>
+
 using namespace std;
 
 namespace grid_map {
 
+constexpr unsigned int PolygonIterator::nInlineVertices;
+
 PolygonIterator::PolygonIterator(const grid_map::GridMap& gridMap, const grid_map::Polygon& polygon)
-    : polygon_(polygon)
+    : nVertices_(polygon.getVertices().size()),
+      indexer_(gridMap.getIndexer()),
+      nToggles_(0),
+      toggleIndex_(0),
+      row_(0),
+      column_(0),
+      columnEnd_(0)
 {
-  mapLength_ = gridMap.getLength();
-  mapPosition_ = gridMap.getPosition();
-  resolution_ = gridMap.getResolution();
-  bufferSize_ = gridMap.getSize();
-  bufferStartIndex_ = gridMap.getStartIndex();
-  Index submapStartIndex;
-  Size submapBufferSize;
-  findSubmapParameters(polygon, submapStartIndex, submapBufferSize);
-  internalIterator_ = std::shared_ptr<SubmapIterator>(new SubmapIterator(gridMap, submapStartIndex, submapBufferSize));
-  if(!isInside()) ++(*this);
-}
+  index_.setZero();
+  submapStartIndex_.setZero();
+  submapSize_.setZero();
+  isPastEnd_ = true;
+  if (nVertices_ < 3) return;
+  if (nVertices_ > nInlineVertices) {
+    vertices_ = polygon.getVertices();
+    toggles_.resize(2 * nVertices_);
+  } else {
+    std::copy(polygon.getVertices().begin(), polygon.getVertices().end(), inlineVertices_.begin());
+  }
+  const Position* vertices = getVertices();
 
-PolygonIterator& PolygonIterator::operator =(const PolygonIterator& other)
-{
-  polygon_ = other.polygon_;
-  internalIterator_ = other.internalIterator_;
-  mapLength_ = other.mapLength_;
-  mapPosition_ = other.mapPosition_;
-  resolution_ = other.resolution_;
-  bufferSize_ = other.bufferSize_;
-  bufferStartIndex_ = other.bufferStartIndex_;
-  return *this;
+  // Submap containing the bounding box of the polygon.
+  Position topLeft = vertices[0];
+  Position bottomRight = topLeft;
+  for (size_t i = 0; i < nVertices_; ++i) {
+    const Position& vertex = vertices[i];
+    topLeft = topLeft.array().max(vertex.array());
+    bottomRight = bottomRight.array().min(vertex.array());
+  }
+  boundPositionToRange(topLeft, indexer_.getLength(), indexer_.getPosition());
+  boundPositionToRange(bottomRight, indexer_.getLength(), indexer_.getPosition());
+  Index startIndex, endIndex;
+  indexer_.getIndexFromPosition(startIndex, topLeft);
+  indexer_.getIndexFromPosition(endIndex, bottomRight);
+  submapSize_ = getSubmapSizeFromCornerIndeces(startIndex, endIndex, indexer_.getSize(), indexer_.getStartIndex());
+  submapStartIndex_ = indexer_.getIndexFromBufferIndex(startIndex);
+  if ((submapSize_ <= 0).any()) return;
+  findNextRow(submapStartIndex_(0));
 }
 
 bool PolygonIterator::operator !=(const PolygonIterator& other) const
 {
-  return (internalIterator_ != other.internalIterator_);
+  return (index_ != other.index_).any();
 }
 
 const Index& PolygonIterator::operator *() const
 {
-  return *(*internalIterator_);
+  return index_;
 }
 
 PolygonIterator& PolygonIterator::operator ++()
 {
-  ++(*internalIterator_);
-  if (internalIterator_->isPastEnd()) return *this;
-
-  for ( ; !internalIterator_->isPastEnd(); ++(*internalIterator_)) {
-    if (isInside()) break;
+  if (isPastEnd_) return *this;
+  if (++column_ < columnEnd_) {
+    if (++index_(1) == indexer_.getSize()(1)) index_(1) = 0;
+    return *this;
   }
-
+  if (!findNextRun()) findNextRow(row_ + 1);
   return *this;
 }
 
 bool PolygonIterator::isPastEnd() const
 {
-  return internalIterator_->isPastEnd();
+  return isPastEnd_;
 }
 
-bool PolygonIterator::isInside() const
+void PolygonIterator::getSpans(std::vector<Span>& spans) const
 {
-  Position position;
-  getPositionFromIndex(position, *(*internalIterator_), mapLength_, mapPosition_, resolution_, bufferSize_, bufferStartIndex_);
-  return polygon_.isInside(position);
+  const Position* vertices = getVertices();
+  PolygonRasterizer(indexer_).getSpans(Polygon(std::vector<Position>(vertices, vertices + nVertices_)), spans);
 }
 
-void PolygonIterator::findSubmapParameters(const grid_map::Polygon& polygon, Index& startIndex, Size& bufferSize) const
+bool PolygonIterator::isCrossing(const size_t edge, const int row, const int column) const
 {
-  Position topLeft = polygon_.getVertices()[0];
-  Position bottomRight = topLeft;
-  for (const auto& vertex : polygon_.getVertices()) {
-    topLeft = topLeft.array().max(vertex.array());
-    bottomRight = bottomRight.array().min(vertex.array());
+  const Position* vertices = getVertices();
+  const Position& vertexI = vertices[edge];
+  const Position& vertexJ = vertices[edge == 0 ? nVertices_ - 1 : edge - 1];
+  // Cell center as in `GridIndexer::getPositionFromIndex(...)`.
+  const double x = indexer_.getFirstCellPosition().x() - indexer_.getResolution() * row;
+  const double y = indexer_.getFirstCellPosition().y() - indexer_.getResolution() * column;
+  return ((vertexI.y() > y) != (vertexJ.y() > y))
+      && (x < (vertexJ.x() - vertexI.x()) * (y - vertexI.y()) / (vertexJ.y() - vertexI.y()) + vertexI.x());
+}
+
+bool PolygonIterator::getCrossingInterval(const size_t edge, const int row, int& begin, int& end) const
+{
+  const Position* vertices = getVertices();
+  const Position& vertexI = vertices[edge];
+  const Position& vertexJ = vertices[edge == 0 ? nVertices_ - 1 : edge - 1];
+  if (vertexI.y() == vertexJ.y()) return false;
+
+  // The cell centers of the row are at y = firstCell.y - resolution * column. The edge counts
+  // for y in [yMin, yMax) and on one side of the intersection with the line through x.
+  const double resolution = indexer_.getResolution();
+  const Position& firstCellPosition = indexer_.getFirstCellPosition();
+  const double x = firstCellPosition.x() - resolution * row;
+  const double yMin = std::min(vertexI.y(), vertexJ.y());
+  const double yMax = std::max(vertexI.y(), vertexJ.y());
+  double columnBegin = (firstCellPosition.y() - yMax) / resolution;
+  double columnEnd = (firstCellPosition.y() - yMin) / resolution;
+  const double dx = vertexJ.x() - vertexI.x();
+  const double dy = vertexJ.y() - vertexI.y();
+  // The crossing cells are the columns c with columnBegin < c <= columnEnd. Ends within
+  // rounding distance of a column are resolved with the crossing test.
+  double toleranceBegin = 1e-6, toleranceEnd = 1e-6;
+  if (dx == 0.0) {
+    if (!(x < vertexI.x())) return false;
+  } else {
+    // x has to be left of the intersection, which holds for larger y (smaller columns)
+    // if the slope dx/dy is positive and for smaller y otherwise.
+    const double columnIntersection = (firstCellPosition.y() - (vertexI.y() + (x - vertexI.x()) * dy / dx)) / resolution;
+    const double tolerance = 1e-6 * (1.0 + std::abs(dy / dx));
+    if ((dx > 0.0) == (dy > 0.0)) {
+      if (columnIntersection < columnEnd) {
+        columnEnd = columnIntersection;
+        toleranceEnd = tolerance;
+      }
+    } else if (columnIntersection > columnBegin) {
+      columnBegin = columnIntersection;
+      toleranceBegin = tolerance;
+    }
+  }
+  const int lowerBound = submapStartIndex_(1);
+  const int upperBound = submapStartIndex_(1) + submapSize_(1);
+  if (columnBegin > columnEnd + 1.0 || columnBegin >= upperBound || columnEnd < lowerBound - 1.0) return false;
+  if (std::abs(columnBegin - std::round(columnBegin)) < toleranceBegin
+      || std::abs(columnEnd - std::round(columnEnd)) < toleranceEnd) {
+    return refineInterval(columnBegin, columnEnd, lowerBound, upperBound,
+                          [this, edge, row](const int column) { return isCrossing(edge, row, column); }, begin, end);
   }
-  boundPositionToRange(topLeft, mapLength_, mapPosition_);
-  boundPositionToRange(bottomRight, mapLength_, mapPosition_);
-  getIndexFromPosition(startIndex, topLeft, mapLength_, mapPosition_, resolution_, bufferSize_, bufferStartIndex_);
-  Index endIndex;
-  getIndexFromPosition(endIndex, bottomRight, mapLength_, mapPosition_, resolution_, bufferSize_, bufferStartIndex_);
-  bufferSize = getSubmapSizeFromCornerIndeces(startIndex, endIndex, bufferSize_, bufferStartIndex_);
+  begin = std::max(lowerBound, static_cast<int>(std::min<double>(std::floor(columnBegin) + 1.0, upperBound)));
+  end = std::max(begin, static_cast<int>(std::min<double>(std::floor(columnEnd) + 1.0, upperBound)));
+  return begin < end;
 }
 
-} /* namespace grid_map */
+const Position* PolygonIterator::getVertices() const
+{
+  return vertices_.empty() ? inlineVertices_.data() : vertices_.data();
+}
 
+int* PolygonIterator::getToggles()
+{
+  return toggles_.empty() ? inlineToggles_.data() : toggles_.data();
+}
+
+void PolygonIterator::findNextRow(int row)
+{
+  const size_t nEdges = nVertices_;
+  for (; row < submapStartIndex_(0) + submapSize_(0); ++row) {
+    // A cell is inside if it is covered by an odd number of crossing intervals, i.e.
+    // between the ends 2k and 2k+1 of the sorted interval ends.
+    int* toggles = getToggles();
+    nToggles_ = 0;
+    for (size_t edge = 0; edge < nEdges; ++edge) {
+      int begin, end;
+      if (!getCrossingInterval(edge, row, begin, end)) continue;
+      toggles[nToggles_++] = begin;
+      toggles[nToggles_++] = end;
+    }
+    if (nToggles_ == 0) continue;
+    std::sort(toggles, toggles + nToggles_);
+    row_ = row;
+    toggleIndex_ = 0;
+    if (findNextRun()) return;
+  }
+  isPastEnd_ = true;
+}
+
+bool PolygonIterator::findNextRun()
+{
+  const int* toggles = getToggles();
+  for (; toggleIndex_ + 1 < nToggles_; toggleIndex_ += 2) {
+    if (toggles[toggleIndex_] == toggles[toggleIndex_ + 1]) continue;
+    column_ = toggles[toggleIndex_];
+    columnEnd_ = toggles[toggleIndex_ + 1];
+    toggleIndex_ += 2;
+    index_ = indexer_.getBufferIndexFromIndex(Index(row_, column_));
+    isPastEnd_ = false;
+    return true;
+  }
+  return false;
+}
+
+} /* namespace grid_map */
@@ -8,6 +8,9 @@
 
 #include "grid_map/iterators/SlidingWindowIterator.hpp"
 #include "grid_map/GridMapMath.hpp"
+#include "grid_map/BufferRegion.hpp"
+
+#include <vector>
 
 #include <iostream>
 
@@ -20,7 +23,7 @@ SlidingWindowIterator::SlidingWindowIterator(const GridMap& gridMap, const std::
       data_(gridMap[layer])
 {
   windowSize_ = windowSize;
-  setup(gridMap);
+  setup();
 }
 
 SlidingWindowIterator::SlidingWindowIterator(const SlidingWindowIterator* other)
@@ -36,7 +39,7 @@ void SlidingWindowIterator::setWindowLength(const GridMap& gridMap, const double
 {
   windowSize_ = std::round(windowLength / gridMap.getResolution());
   if (windowSize_ % 2 != 1) ++windowSize_;
-  setup(gridMap);
+  setup();
 }
 
 SlidingWindowIterator& SlidingWindowIterator::operator ++()
@@ -54,7 +57,7 @@ SlidingWindowIterator& SlidingWindowIterator::operator ++()
 
 const Matrix SlidingWindowIterator::getData() const
 {
-  const Index centerIndex(*(*this));
+  const Index centerIndex(getUnwrappedIndex());
   const Index windowMargin(Index::Constant(windowMargin_));
   const Index originalTopLeftIndex(centerIndex - windowMargin);
   Index topLeftIndex(originalTopLeftIndex);
@@ -66,10 +69,10 @@ const Matrix SlidingWindowIterator::getData() const
   switch (edgeHandling_) {
     case EdgeHandling::INSIDE:
     case EdgeHandling::CROP:
-      return data_.block(topLeftIndex(0), topLeftIndex(1), adjustedWindowSize(0), adjustedWindowSize(1));
+      return getBlock(topLeftIndex, adjustedWindowSize);
     case EdgeHandling::EMPTY:
     case EdgeHandling::MEAN:
-      const Matrix data = data_.block(topLeftIndex(0), topLeftIndex(1), adjustedWindowSize(0), adjustedWindowSize(1));
+      const Matrix data = getBlock(topLeftIndex, adjustedWindowSize);
       Matrix returnData(windowSize_, windowSize_);
       if (edgeHandling_ == EdgeHandling::EMPTY) returnData.setConstant(NAN);
       else if (edgeHandling_ == EdgeHandling::MEAN)
@@ -77,17 +80,14 @@ const Matrix SlidingWindowIterator::getData() const
           returnData.setConstant(data.meanOfFinites());
       }
       const Index topLeftIndexShift(topLeftIndex - originalTopLeftIndex);
-      returnData.block(topLeftIndexShift(0), topLeftIndexShift(1), adjustedWindowSize(0), adjustedWindowSize(1)) =
-          data_.block(topLeftIndex(0), topLeftIndex(1), adjustedWindowSize(0), adjustedWindowSize(1));
+      returnData.block(topLeftIndexShift(0), topLeftIndexShift(1), adjustedWindowSize(0), adjustedWindowSize(1)) = data;
       return returnData;
   }
   return Matrix::Zero(0, 0);
 }
 
-void SlidingWindowIterator::setup(const GridMap& gridMap)
+void SlidingWindowIterator::setup()
 {
-  if (!gridMap.isDefaultStartIndex()) throw std::runtime_error(
-      "SlidingWindowIterator cannot be used with grid maps that don't have a default buffer start index.");
   if (windowSize_ % 2 == 0) throw std::runtime_error(
       "SlidingWindowIterator has a wrong window size!");
   windowMargin_ = (windowSize_ - 1) / 2;
@@ -101,11 +101,44 @@ void SlidingWindowIterator::setup(const GridMap& gridMap)
 
 bool SlidingWindowIterator::dataInsideMap() const
 {
-  const Index centerIndex(*(*this));
+  const Index centerIndex(getUnwrappedIndex());
   const Index windowMargin(Index::Constant(windowMargin_));
   const Index topLeftIndex(centerIndex - windowMargin);
   const Index bottomRightIndex(centerIndex + windowMargin);
   return checkIfIndexInRange(topLeftIndex, size_) && checkIfIndexInRange(bottomRightIndex, size_);
 }
 
+Matrix SlidingWindowIterator::getBlock(const Index& topLeftIndex, const Size& size) const
+{
+  const Index bufferIndex(getBufferIndexFromIndex(topLeftIndex, size_, startIndex_));
+  if ((startIndex_ == 0).all()) {
+    return data_.block(bufferIndex(0), bufferIndex(1), size(0), size(1));
+  }
+  std::vector<BufferRegion> bufferRegions;
+  getBufferRegionsForSubmap(bufferRegions, bufferIndex, size, size_, startIndex_);
+  Matrix data(size(0), size(1));
+  for (const auto& bufferRegion : bufferRegions) {
+    const Index& index = bufferRegion.getStartIndex();
+    const Size& regionSize = bufferRegion.getSize();
+    const auto block = data_.block(index(0), index(1), regionSize(0), regionSize(1));
+    switch (bufferRegion.getQuadrant()) {
+      case BufferRegion::Quadrant::TopLeft:
+        data.topLeftCorner(regionSize(0), regionSize(1)) = block;
+        break;
+      case BufferRegion::Quadrant::TopRight:
+        data.topRightCorner(regionSize(0), regionSize(1)) = block;
+        break;
+      case BufferRegion::Quadrant::BottomLeft:
+        data.bottomLeftCorner(regionSize(0), regionSize(1)) = block;
+        break;
+      case BufferRegion::Quadrant::BottomRight:
+        data.bottomRightCorner(regionSize(0), regionSize(1)) = block;
+        break;
+      default:
+        break;
+    }
+  }
+  return data;
+}
+
 } /* namespace grid_map */
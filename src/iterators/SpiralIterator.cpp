@@ -28,11 +28,11 @@ SpiralIterator::SpiralIterator(const grid_map::GridMap& gridMap, const Eigen::Ve
   bufferSize_ = gridMap.getSize();
   gridMap.getIndex(center_, indexCenter_);
   nRings_ = std::ceil(radius_ / resolution_);
-  if (checkIfIndexInRange(indexCenter_, bufferSize_))
-    pointsRing_.push_back(indexCenter_);
-  else
-    while(pointsRing_.empty() && !isPastEnd())
-      generateRing();
+  rings_ = RingOffsetTable::get(nRings_);
+  ringPosition_ = rings_->getRingSize(0);
+  index_ = indexCenter_;
+  isPastEnd_ = false;
+  findNextCell();
 }
 
 SpiralIterator& SpiralIterator::operator =(const SpiralIterator& other)
@@ -43,7 +43,10 @@ SpiralIterator& SpiralIterator::operator =(const SpiralIterator& other)
   radiusSquare_ = other.radiusSquare_;
   nRings_ = other.nRings_;
   distance_ = other.distance_;
-  pointsRing_ = other.pointsRing_;
+  rings_ = other.rings_;
+  ringPosition_ = other.ringPosition_;
+  index_ = other.index_;
+  isPastEnd_ = other.isPastEnd_;
   mapLength_ = other.mapLength_;
   mapPosition_ = other.mapPosition_;
   resolution_ = other.resolution_;
@@ -53,24 +56,23 @@ SpiralIterator& SpiralIterator::operator =(const SpiralIterator& other)
 
 bool SpiralIterator::operator !=(const SpiralIterator& other) const
 {
-  return (pointsRing_.back() != pointsRing_.back()).any();
+  return (index_ != other.index_).any();
 }
 
 const Eigen::Array2i& SpiralIterator::operator *() const
 {
-  return pointsRing_.back();
+  return index_;
 }
 
 SpiralIterator& SpiralIterator::operator ++()
 {
-  pointsRing_.pop_back();
-  if (pointsRing_.empty() && !isPastEnd()) generateRing();
+  if (!isPastEnd_) findNextCell();
   return *this;
 }
 
 bool SpiralIterator::isPastEnd() const
 {
-  return (distance_ == nRings_ && pointsRing_.empty());
+  return isPastEnd_;
 }
 
 bool SpiralIterator::isInside(const Index index) const
@@ -81,36 +83,27 @@ bool SpiralIterator::isInside(const Index index) const
   return (squareNorm <= radiusSquare_);
 }
 
-void SpiralIterator::generateRing()
+void SpiralIterator::findNextCell()
 {
-  distance_++;
-  Index point(distance_, 0);
-  Index pointInMap;
-  Index normal;
-  do {
-    pointInMap.x() = point.x() + indexCenter_.x();
-    pointInMap.y() = point.y() + indexCenter_.y();
-    if (checkIfIndexInRange(pointInMap, bufferSize_)) {
-      if (distance_ == nRings_ || distance_ == nRings_ - 1) {
-        if (isInside(pointInMap))
-          pointsRing_.push_back(pointInMap);
-      } else {
-        pointsRing_.push_back(pointInMap);
-      }
+  // The rings are visited from the end, only the two outermost rings can contain
+  // cells outside of the circle.
+  while (true) {
+    const Index* ring = rings_->getRing(distance_);
+    const bool checkInside = distance_ > 0 && (distance_ == nRings_ || distance_ + 1 == nRings_);
+    while (ringPosition_ > 0) {
+      const Index index = indexCenter_ + ring[--ringPosition_];
+      if (!checkIfIndexInRange(index, bufferSize_)) continue;
+      if (checkInside && !isInside(index)) continue;
+      index_ = index;
+      return;
     }
-    normal.x() = -signum(point.y());
-    normal.y() = signum(point.x());
-    if (normal.x() != 0
-        && (int) Vector(point.x() + normal.x(), point.y()).norm() == distance_)
-      point.x() += normal.x();
-    else if (normal.y() != 0
-        && (int) Vector(point.x(), point.y() + normal.y()).norm() == distance_)
-      point.y() += normal.y();
-    else {
-      point.x() += normal.x();
-      point.y() += normal.y();
+    if (distance_ >= nRings_) {
+      isPastEnd_ = true;
+      return;
     }
-  } while (point.x() != distance_ || point.y() != 0);
+    ++distance_;
+    ringPosition_ = rings_->getRingSize(distance_);
+  }
 }
 
 double SpiralIterator::getCurrentRadius() const
@@ -92,5 +92,15 @@ const Size& SubmapIterator::getSubmapSize() const
   return submapSize_;
 }
 
+const Index& SubmapIterator::getSubmapStartIndex() const
+{
+  return submapStartIndex_;
+}
+
+void SubmapIterator::getSpans(std::vector<Span>& spans) const
+{
+  getSpansForSubmap(spans, submapStartIndex_, submapSize_, size_, startIndex_);
+}
+
 } /* namespace grid_map */
 
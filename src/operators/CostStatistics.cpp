@@ -0,0 +1,222 @@
+/**
+ * @file /cost_map_core/src/lib/operators/CostStatistics.cpp
+ */
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include "grid_map/operators/CostStatistics.hpp"
+#include <algorithm>
+#include <stdexcept>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace grid_map {
+
+/*****************************************************************************
+** Cost Statistics
+*****************************************************************************/
+
+CostStatistics::CostStatistics()
+: number_of_known(0)
+, number_of_unknown(0)
+, number_of_lethal(0)
+, sum(0)
+, min(255)
+, max(0)
+{}
+
+CostStatistics& CostStatistics::operator+=(const CostStatistics& other)
+{
+  number_of_known += other.number_of_known;
+  number_of_unknown += other.number_of_unknown;
+  number_of_lethal += other.number_of_lethal;
+  sum += other.sum;
+  min = std::min(min, other.min);
+  max = std::max(max, other.max);
+  return *this;
+}
+
+double CostStatistics::mean() const
+{
+  return number_of_known > 0 ? static_cast<double>(sum) / number_of_known : 0.0;
+}
+
+double CostStatistics::lethalFraction() const
+{
+  return number_of_known > 0 ? static_cast<double>(number_of_lethal) / number_of_known : 0.0;
+}
+
+/*****************************************************************************
+** Cost Statistics Computer
+*****************************************************************************/
+
+CostStatisticsComputer::CostStatisticsComputer(const unsigned char& unknown_cost, const unsigned char& lethal_cost)
+: unknown_cost_(unknown_cost)
+, lethal_cost_(lethal_cost)
+{}
+
+void CostStatisticsComputer::accumulate(const unsigned char* data, const size_t& size,
+                                        CostStatistics& statistics) const
+{
+  const unsigned char unknown = unknown_cost_, lethal = lethal_cost_;
+  unsigned char min = statistics.min, max = statistics.max;
+  uint64_t known = 0, lethals = 0, sum = 0;
+  size_t i = 0;
+#if defined(__SSE2__)
+  // 16 cells at once: unknown cells are masked to the identity of each reduction,
+  // counts and sums are accumulated with the sum of absolute differences to zero
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i one = _mm_set1_epi8(1);
+  const __m128i unknown_value = _mm_set1_epi8(static_cast<char>(unknown));
+  const __m128i lethal_value = _mm_set1_epi8(static_cast<char>(lethal));
+  __m128i known_sum = zero, lethal_sum = zero, cost_sum = zero;
+  __m128i min_value = _mm_set1_epi8(static_cast<char>(min)), max_value = _mm_set1_epi8(static_cast<char>(max));
+  for (; i + 16 <= size; i += 16) {
+    const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+    const __m128i is_unknown = _mm_cmpeq_epi8(value, unknown_value);
+    const __m128i known_value = _mm_andnot_si128(is_unknown, value);
+    const __m128i is_lethal = _mm_andnot_si128(is_unknown, _mm_cmpeq_epi8(_mm_max_epu8(value, lethal_value), value));
+    known_sum = _mm_add_epi64(known_sum, _mm_sad_epu8(_mm_andnot_si128(is_unknown, one), zero));
+    lethal_sum = _mm_add_epi64(lethal_sum, _mm_sad_epu8(_mm_and_si128(is_lethal, one), zero));
+    cost_sum = _mm_add_epi64(cost_sum, _mm_sad_epu8(known_value, zero));
+    min_value = _mm_min_epu8(min_value, _mm_or_si128(value, is_unknown));
+    max_value = _mm_max_epu8(max_value, known_value);
+  }
+  uint64_t lanes[2];
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), known_sum);
+  known += lanes[0] + lanes[1];
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), lethal_sum);
+  lethals += lanes[0] + lanes[1];
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), cost_sum);
+  sum += lanes[0] + lanes[1];
+  unsigned char bytes[16];
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(bytes), min_value);
+  min = *std::min_element(bytes, bytes + 16);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(bytes), max_value);
+  max = *std::max_element(bytes, bytes + 16);
+#endif
+  for (; i < size; ++i) {
+    const unsigned char value = data[i];
+    if (value == unknown) continue;
+    ++known;
+    lethals += value >= lethal;
+    sum += value;
+    min = std::min(min, value);
+    max = std::max(max, value);
+  }
+  statistics.number_of_known += known;
+  statistics.number_of_unknown += size - known;
+  statistics.number_of_lethal += lethals;
+  statistics.sum += sum;
+  statistics.min = min;
+  statistics.max = max;
+}
+
+void CostStatisticsComputer::accumulate(const unsigned char* data, const size_t& size, std::vector<uint32_t>& counts)
+{
+  // four sub-histograms, such that runs of equal costs do not wait on each other
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    ++counts[data[i]];
+    ++counts[256 + data[i + 1]];
+    ++counts[512 + data[i + 2]];
+    ++counts[768 + data[i + 3]];
+  }
+  for (; i < size; ++i) ++counts[data[i]];
+}
+
+void CostStatisticsComputer::merge(const std::vector<uint32_t>& counts, CostHistogram& histogram)
+{
+  for (int cost = 0; cost < 256; ++cost) {
+    histogram[cost] = size_t(counts[cost]) + counts[256 + cost] + counts[512 + cost] + counts[768 + cost];
+  }
+}
+
+std::vector<Span> CostStatisticsComputer::getSubmapSpans(const Index& start_index, const Size& size,
+                                                         const GridMap& cost_map)
+{
+  std::vector<Span> spans;
+  if (!getSpansForSubmap(spans, start_index, size, cost_map.getSize(), cost_map.getStartIndex())) {
+    throw std::out_of_range("CostStatisticsComputer: submap is not inside the map");
+  }
+  return spans;
+}
+
+CostStatistics CostStatisticsComputer::operator()(const grid_map::Matrix& data) const
+{
+  CostStatistics statistics;
+  accumulate(data.data(), data.size(), statistics);
+  return statistics;
+}
+
+CostStatistics CostStatisticsComputer::operator()(const grid_map::Matrix& data, const BufferRegion& region) const
+{
+  CostStatistics statistics;
+  const Index& start = region.getStartIndex();
+  for (int column = start(1); column < start(1) + region.getSize()(1); ++column) {
+    accumulate(Span(column, start(0), region.getSize()(0)).data(data), region.getSize()(0), statistics);
+  }
+  return statistics;
+}
+
+CostStatistics CostStatisticsComputer::operator()(const grid_map::Matrix& data, const std::vector<Span>& spans) const
+{
+  CostStatistics statistics;
+  for (const auto& span : spans) {
+    accumulate(span.data(data), span.length, statistics);
+  }
+  return statistics;
+}
+
+CostStatistics CostStatisticsComputer::operator()(const std::string& layer,
+                                                  const Index& start_index,
+                                                  const Size& size,
+                                                  const GridMap& cost_map) const
+{
+  return (*this)(cost_map.get(layer), getSubmapSpans(start_index, size, cost_map));
+}
+
+void CostStatisticsComputer::histogram(const grid_map::Matrix& data, CostHistogram& histogram) const
+{
+  std::vector<uint32_t> counts(4 * 256, 0);
+  accumulate(data.data(), data.size(), counts);
+  merge(counts, histogram);
+}
+
+void CostStatisticsComputer::histogram(const grid_map::Matrix& data, const BufferRegion& region,
+                                       CostHistogram& histogram) const
+{
+  std::vector<uint32_t> counts(4 * 256, 0);
+  const Index& start = region.getStartIndex();
+  for (int column = start(1); column < start(1) + region.getSize()(1); ++column) {
+    accumulate(Span(column, start(0), region.getSize()(0)).data(data), region.getSize()(0), counts);
+  }
+  merge(counts, histogram);
+}
+
+void CostStatisticsComputer::histogram(const grid_map::Matrix& data, const std::vector<Span>& spans,
+                                       CostHistogram& histogram) const
+{
+  std::vector<uint32_t> counts(4 * 256, 0);
+  for (const auto& span : spans) {
+    accumulate(span.data(data), span.length, counts);
+  }
+  merge(counts, histogram);
+}
+
+void CostStatisticsComputer::histogram(const std::string& layer,
+                                       const Index& start_index,
+                                       const Size& size,
+                                       const GridMap& cost_map,
+                                       CostHistogram& histogram) const
+{
+  this->histogram(cost_map.get(layer), getSubmapSpans(start_index, size, cost_map), histogram);
+}
+
+} // namespace grid_map
@@ -0,0 +1,98 @@
+/**
+ * @file /cost_map_core/src/lib/FillPolygons.cpp
+ */
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include "grid_map/operators/FillPolygons.hpp"
+#include "grid_map/PolygonRasterizer.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace grid_map {
+
+/*****************************************************************************
+** Implementation
+*****************************************************************************/
+
+FillPolygons::FillPolygons(const PolygonFillMode& mode, const unsigned int& tile_width)
+: mode_(mode)
+, tile_width_(std::max(tile_width, 1u))
+{}
+
+void FillPolygons::operator()(const std::string& layer,
+                              const std::vector<Polygon>& polygons,
+                              const std::vector<unsigned char>& values,
+                              GridMap& cost_map,
+                              ThreadPool& thread_pool)
+{
+  if (values.size() != polygons.size()) {
+    throw std::invalid_argument("FillPolygons: number of values does not match the number of polygons");
+  }
+  grid_map::Matrix& data = cost_map.get(layer);
+
+  // spans of all polygons, independent of each other
+  const PolygonRasterizer rasterizer(cost_map.getIndexer());
+  std::vector<std::vector<Span>> polygon_spans(polygons.size());
+  thread_pool.run(polygons.size(), [&](const size_t i, const unsigned int) {
+    rasterizer.getSpans(polygons[i], polygon_spans[i]);
+  });
+
+  // counting sort of the spans into tiles of columns, keeping the order of the polygons
+  const size_t number_of_tiles = (data.cols() + tile_width_ - 1) / tile_width_;
+  std::vector<size_t> tile_begins(number_of_tiles + 1, 0);
+  for (const auto& spans : polygon_spans) {
+    for (const auto& span : spans) {
+      ++tile_begins[span.column / tile_width_ + 1];
+    }
+  }
+  for (size_t i = 1; i < tile_begins.size(); ++i) {
+    tile_begins[i] += tile_begins[i - 1];
+  }
+  std::vector<Span> tile_spans(tile_begins.back());
+  std::vector<unsigned char> tile_values(tile_begins.back());
+  std::vector<size_t> fill(tile_begins.begin(), tile_begins.end() - 1);
+  for (size_t i = 0; i < polygon_spans.size(); ++i) {
+    for (const auto& span : polygon_spans[i]) {
+      const size_t j = fill[span.column / tile_width_]++;
+      tile_spans[j] = span;
+      tile_values[j] = values[i];
+    }
+  }
+
+  // each tile owns its columns, the tiles can be filled concurrently
+  const PolygonFillMode mode = mode_;
+  thread_pool.run(number_of_tiles, [&](const size_t tile, const unsigned int) {
+    for (size_t i = tile_begins[tile]; i < tile_begins[tile + 1]; ++i) {
+      auto segment = tile_spans[i].segment(data);
+      const unsigned char value = tile_values[i];
+      switch (mode) {
+        case PolygonFillMode::OVERWRITE:
+          segment.setConstant(value);
+          break;
+        case PolygonFillMode::MAXIMUM:
+          segment = segment.cwiseMax(value);
+          break;
+        case PolygonFillMode::MINIMUM:
+          segment = segment.cwiseMin(value);
+          break;
+      }
+    }
+  });
+}
+
+void FillPolygons::operator()(const std::string& layer,
+                              const std::vector<Polygon>& polygons,
+                              const unsigned char& value,
+                              GridMap& cost_map,
+                              ThreadPool& thread_pool)
+{
+  (*this)(layer, polygons, std::vector<unsigned char>(polygons.size(), value), cost_map, thread_pool);
+}
+
+} // namespace grid_map
@@ -0,0 +1,199 @@
+/**
+ * @file /cost_map_core/src/lib/operators/FootprintChecker.cpp
+ */
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include "grid_map/operators/FootprintChecker.hpp"
+#include <algorithm>
+#include <cmath>
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace grid_map {
+
+/*****************************************************************************
+** Footprint Checker
+*****************************************************************************/
+
+FootprintChecker::FootprintChecker(const Polygon& footprint, const unsigned int& number_of_headings)
+: footprint_(footprint)
+, number_of_headings_(std::max(number_of_headings, 1u))
+, resolution_(0.0)
+, lethal_cost_(LETHAL_OBSTACLE)
+, outside_cost_(NO_INFORMATION)
+{
+}
+
+bool FootprintChecker::update(const double& resolution)
+{
+  if (resolution == resolution_) return false;
+  resolution_ = resolution;
+  runs_.clear();
+  heading_begins_.assign(1, 0);
+  min_offsets_.clear();
+  max_offsets_.clear();
+
+  // rasterize on a small grid with the center of the middle cell at the origin
+  double radius = 0.0;
+  for (const auto& vertex : footprint_.getVertices()) radius = std::max(radius, vertex.norm());
+  const int half_size = static_cast<int>(std::ceil(radius / resolution_)) + 1;
+  const int size = 2 * half_size + 1;
+  const GridIndexer indexer(Length(size * resolution_, size * resolution_), Position::Zero(), resolution_, Size(size, size));
+  PolygonRasterizer rasterizer(indexer);
+  std::vector<Span> spans;
+  for (unsigned int k = 0; k < number_of_headings_; ++k) {
+    const double heading = 2.0 * M_PI * k / number_of_headings_;
+    const Eigen::Matrix2d rotation = (Eigen::Matrix2d() << std::cos(heading), -std::sin(heading),
+                                                           std::sin(heading), std::cos(heading)).finished();
+    Polygon polygon;
+    for (const auto& vertex : footprint_.getVertices()) polygon.addVertex(rotation * vertex);
+    rasterizer.getSpans(polygon, spans);
+    Index min_offset(Index::Zero()), max_offset(Index::Zero());
+    for (const auto& span : spans) {
+      const Run run = {span.column - half_size, span.rowStart - half_size, span.length};
+      runs_.push_back(run);
+      min_offset = min_offset.min(Index(run.row_start, run.column));
+      max_offset = max_offset.max(Index(run.row_start + run.length - 1, run.column));
+    }
+    heading_begins_.push_back(runs_.size());
+    min_offsets_.push_back(min_offset);
+    max_offsets_.push_back(max_offset);
+  }
+  return true;
+}
+
+void FootprintChecker::setLethalCost(const unsigned char& lethal_cost)
+{
+  lethal_cost_ = lethal_cost;
+}
+
+void FootprintChecker::setOutsideCost(const unsigned char& outside_cost)
+{
+  outside_cost_ = outside_cost;
+}
+
+unsigned char FootprintChecker::getCost(const std::string& layer,
+                                        const Position& position,
+                                        const double& heading,
+                                        const GridMap& cost_map)
+{
+  update(cost_map.getResolution());
+  return getCost(cost_map.get(layer), cost_map.getIndexer(), position, heading);
+}
+
+bool FootprintChecker::isInCollision(const std::string& layer,
+                                     const Position& position,
+                                     const double& heading,
+                                     const GridMap& cost_map)
+{
+  return getCost(layer, position, heading, cost_map) >= lethal_cost_;
+}
+
+void FootprintChecker::getCosts(const std::string& layer,
+                                const Eigen::Ref<const Eigen::Matrix3Xd>& poses,
+                                const GridMap& cost_map,
+                                std::vector<unsigned char>& costs,
+                                ThreadPool& thread_pool)
+{
+  update(cost_map.getResolution());
+  const grid_map::Matrix& data = cost_map.get(layer);
+  const GridIndexer& indexer = cost_map.getIndexer();
+  costs.resize(poses.cols());
+  const size_t chunk_size = 64;
+  thread_pool.run((poses.cols() + chunk_size - 1) / chunk_size, [&](const size_t chunk, const unsigned int) {
+    const size_t end = std::min<size_t>(poses.cols(), (chunk + 1) * chunk_size);
+    for (size_t i = chunk * chunk_size; i < end; ++i) {
+      costs[i] = getCost(data, indexer, Position(poses(0, i), poses(1, i)), poses(2, i));
+    }
+  });
+}
+
+unsigned char FootprintChecker::getCost(const grid_map::Matrix& data,
+                                        const GridIndexer& indexer,
+                                        const Position& position,
+                                        const double& heading) const
+{
+  const unsigned int heading_index = getHeadingIndex(heading);
+  const Run* runs = runs_.data() + heading_begins_[heading_index];
+  const Run* runs_end = runs_.data() + heading_begins_[heading_index + 1];
+  const Size& size = indexer.getSize();
+  const Index& min_offset = min_offsets_[heading_index];
+  const Index& max_offset = max_offsets_[heading_index];
+  // the robot cell can be outside of the map while the footprint still overlaps it
+  const Index index = indexer.getIndexCoordinatesFromPosition(position).floor().cast<int>();
+  if (((index + max_offset) < 0).any() || ((index + min_offset) >= size).any()) return outside_cost_;
+  const Index buffer_index = indexer.getBufferIndexFromIndex(index);
+  unsigned char cost = 0;
+
+  // the footprint is inside the map and does not cross the wrap of the buffer: fixed pointer offsets
+  if (((index + min_offset) >= 0).all() && ((index + max_offset) < size).all()
+      && ((buffer_index + min_offset) >= 0).all() && ((buffer_index + max_offset) < size).all()) {
+    const unsigned char* center = data.data() + static_cast<Eigen::Index>(buffer_index(1)) * size(0) + buffer_index(0);
+    for (const Run* run = runs; run != runs_end; ++run) {
+      const unsigned char* cell = center + static_cast<Eigen::Index>(run->column) * size(0) + run->row_start;
+      for (int i = 0; i < run->length; ++i) cost = std::max(cost, cell[i]);
+      if (cost >= lethal_cost_) return cost;
+    }
+    return cost;
+  }
+
+  // clip the runs to the map and split them at the wrap of the buffer
+  for (const Run* run = runs; run != runs_end; ++run) {
+    const int column = index(1) + run->column;
+    int row_begin = index(0) + run->row_start;
+    int row_end = row_begin + run->length;
+    if (column < 0 || column >= size(1) || row_begin < 0 || row_end > size(0)) {
+      cost = std::max(cost, outside_cost_);
+      if (cost >= lethal_cost_) return cost;
+      if (column < 0 || column >= size(1)) continue;
+      row_begin = std::max(row_begin, 0);
+      row_end = std::min(row_end, size(0));
+    }
+    while (row_begin < row_end) {
+      const Index start = indexer.getBufferIndexFromIndex(Index(row_begin, column));
+      const int length = std::min(row_end - row_begin, size(0) - start(0));
+      const unsigned char* cell = &data(start(0), start(1));
+      for (int i = 0; i < length; ++i) cost = std::max(cost, cell[i]);
+      if (cost >= lethal_cost_) return cost;
+      row_begin += length;
+    }
+  }
+  return cost;
+}
+
+unsigned int FootprintChecker::getHeadingIndex(const double& heading) const
+{
+  const double step = 2.0 * M_PI / number_of_headings_;
+  long index = std::lround(heading / step) % static_cast<long>(number_of_headings_);
+  if (index < 0) index += number_of_headings_;
+  return static_cast<unsigned int>(index);
+}
+
+unsigned int FootprintChecker::getNumberOfHeadings() const
+{
+  return number_of_headings_;
+}
+
+size_t FootprintChecker::getNumberOfCells(const unsigned int& heading_index) const
+{
+  size_t number_of_cells = 0;
+  for (size_t i = heading_begins_.at(heading_index); i < heading_begins_.at(heading_index + 1); ++i) {
+    number_of_cells += runs_[i].length;
+  }
+  return number_of_cells;
+}
+
+unsigned char FootprintChecker::getLethalCost() const
+{
+  return lethal_cost_;
+}
+
+/*****************************************************************************
+** Trailers
+*****************************************************************************/
+
+} // namespace grid_map
@@ -7,6 +7,7 @@
 
 #include <iostream>
 #include "grid_map/operators/Inflation.hpp"
+#include "grid_map/ParallelForEach.hpp"
 
 /*****************************************************************************
 ** Namespaces
@@ -189,23 +190,27 @@ void Deflate::operator()(const std::string layer_source,
 {
   // make a call on the data, just to check that the layer is there
   // will throw std::out_of_range if not
-  grid_map::Matrix data_source = cost_map.get(layer_source);
-  // add a layer filled with NO_INFORMATION
-  cost_map.add(layer_destination);
+  const grid_map::Matrix& data_source = cost_map.get(layer_source);
+  // add a layer filled with NO_INFORMATION (unless stripping in place, every cell is written below)
+  if (layer_destination != layer_source) {
+    cost_map.add(layer_destination);
+  }
   grid_map::Matrix& data_destination = cost_map.get(layer_destination);
 
   unsigned char cost_threshold = do_not_strip_inscribed_region ? grid_map::INSCRIBED_OBSTACLE : grid_map::LETHAL_OBSTACLE;
 
-  // eigen is by default column major - iterate with the row index changing fastest
-  for (unsigned int j = 0, number_of_rows = data_source.rows(), number_of_columns = data_source.cols(); j < number_of_columns; ++j) {
-    for (unsigned int i = 0; i < number_of_rows; ++i) {
-      unsigned char cost = data_source(i, j);
-      data_destination(i, j) = (cost >= cost_threshold ) ? cost : grid_map::FREE_SPACE;
+  // spans are contiguous runs of a column (eigen is by default column major), distributed over threads
+  std::vector<grid_map::Span> spans;
+  grid_map::GridMapIterator(cost_map).getSpans(spans);
+  grid_map::parallelForEachSpan(spans, [&](const grid_map::Span& span) {
+    const unsigned char* source = span.data(data_source);
+    unsigned char* destination = span.data(data_destination);
+    for (int i = 0; i < span.length; ++i) {
+      destination[i] = (source[i] >= cost_threshold ) ? source[i] : grid_map::FREE_SPACE;
     }
-  }
+  });
 }
 
-
 /*****************************************************************************
  ** Trailers
  *****************************************************************************/
@@ -0,0 +1,307 @@
+/**
+ * @file /cost_map_core/src/lib/MarkAndClear.cpp
+ */
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include "grid_map/operators/MarkAndClear.hpp"
+#include "grid_map/Parallel.hpp"
+#include "grid_map/RayCaster.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace grid_map {
+
+/*****************************************************************************
+** Helpers
+*****************************************************************************/
+
+namespace {
+
+/**
+ * @brief One bit per cell of the buffer (column major), safe to set from several threads.
+ */
+class AtomicBitset {
+public:
+  /**
+   * @param size the number of bits
+   * @param is_concurrent false if only one thread sets bits (avoids the atomic read-modify-write)
+   */
+  AtomicBitset(const size_t& size, const bool& is_concurrent)
+  : words_((size + 63) / 64)
+  , is_concurrent_(is_concurrent)
+  {}
+
+  /**
+   * @brief Set a bit.
+   * @return true if the bit was not set before
+   */
+  bool set(const size_t& i) {
+    const uint64_t mask = uint64_t(1) << (i % 64);
+    std::atomic<uint64_t>& word = words_[i / 64];
+    // cells near the origin are hit by most rays, only read them once they are set
+    const uint64_t value = word.load(std::memory_order_relaxed);
+    if (value & mask) {
+      return false;
+    }
+    if (!is_concurrent_) {
+      word.store(value | mask, std::memory_order_relaxed);
+      return true;
+    }
+    return !(word.fetch_or(mask, std::memory_order_relaxed) & mask);
+  }
+
+  size_t numberOfWords() const { return words_.size(); }
+  uint64_t word(const size_t& i) const { return words_[i].load(std::memory_order_relaxed); }
+
+private:
+  std::vector<std::atomic<uint64_t>> words_;
+  bool is_concurrent_;
+};
+
+/**
+ * @brief Clear the cells of a bitset, cells are visited once no matter how many rays crossed them.
+ */
+void clearCells(const AtomicBitset& cleared, const bool& clear_unknown_space,
+                const unsigned int& number_of_threads, grid_map::Matrix& data)
+{
+  parallelFor(0, cleared.numberOfWords(), number_of_threads, [&](const size_t w) {
+    uint64_t word = cleared.word(w);
+    for (size_t i = w * 64; word != 0; ++i, word >>= 1) {
+      if (!(word & 1)) {
+        continue;
+      }
+      unsigned char& cost = data.data()[i];
+      if (clear_unknown_space || cost != grid_map::NO_INFORMATION) {
+        cost = grid_map::FREE_SPACE;
+      }
+    }
+  });
+}
+
+} // namespace
+
+/*****************************************************************************
+** Implementation
+*****************************************************************************/
+
+MarkAndClear::MarkAndClear(const double& obstacle_range, const double& raytrace_range,
+                           const bool& clear_unknown_space)
+: obstacle_range_(obstacle_range)
+, raytrace_range_(raytrace_range)
+, clear_unknown_space_(clear_unknown_space)
+, number_of_threads_(1)
+, dirty_start_index_(Index::Zero())
+, dirty_size_(Size::Zero())
+{
+}
+
+void MarkAndClear::setNumberOfThreads(const unsigned int& number_of_threads)
+{
+  number_of_threads_ = number_of_threads;
+}
+
+void MarkAndClear::getDirtyRegion(Index& start_index, Size& size) const
+{
+  start_index = dirty_start_index_;
+  size = dirty_size_;
+}
+
+bool MarkAndClear::operator()(const std::string& layer,
+                              const Position& origin,
+                              const std::vector<Position>& endpoints,
+                              GridMap& cost_map
+                              )
+{
+  grid_map::Matrix& data = cost_map.get(layer);
+  const GridIndexer& indexer = cost_map.getIndexer();
+  const int number_of_rows = data.rows();
+  const size_t number_of_cells = static_cast<size_t>(data.rows()) * data.cols();
+  RayCaster ray_caster(cost_map);
+
+  // cells to clear, and the end cells of the rays traced so far (without/with the end cell)
+  const bool is_concurrent = resolveNumberOfThreads(number_of_threads_) > 1;
+  AtomicBitset cleared(number_of_cells, is_concurrent), traced_open(number_of_cells, is_concurrent),
+      traced_closed(number_of_cells, is_concurrent);
+  std::vector<Index> ray_bounds(2 * endpoints.size(), Index::Constant(-1));
+
+  parallelFor(0, endpoints.size(), number_of_threads_, [&](const size_t ray) {
+    Position end = endpoints[ray];
+    const double range = (end - origin).norm();
+    if (range > raytrace_range_) {
+      end = origin + (end - origin) * (raytrace_range_ / range);
+    }
+    // a ray ending at its measurement keeps the end cell (it is marked), a ray limited
+    // by the range or the map clears it
+    Index end_index;
+    const bool is_end_inside = indexer.getIndexFromPosition(end_index, end);
+    const bool is_limited = range > raytrace_range_ || !is_end_inside;
+    if (is_end_inside) {
+      AtomicBitset& traced = is_limited ? traced_closed : traced_open;
+      if (!traced.set(static_cast<size_t>(end_index(1)) * number_of_rows + end_index(0))) {
+        return;
+      }
+    }
+    Index previous = Index::Constant(-1);
+    ray_caster.castRay(origin, end, [&](const Index& index) {
+      if (previous(0) >= 0) {
+        cleared.set(static_cast<size_t>(previous(1)) * number_of_rows + previous(0));
+      } else {
+        ray_bounds[2 * ray] = index;
+      }
+      previous = index;
+      return true;
+    });
+    if (previous(0) >= 0) {
+      ray_bounds[2 * ray + 1] = previous;
+      if (is_limited) {
+        cleared.set(static_cast<size_t>(previous(1)) * number_of_rows + previous(0));
+      }
+    }
+  });
+
+  clearCells(cleared, clear_unknown_space_, number_of_threads_, data);
+  return markEndpoints(origin, endpoints, ray_bounds, indexer, data);
+}
+
+bool MarkAndClear::markEndpoints(const Position& origin,
+                                 const std::vector<Position>& endpoints,
+                                 const std::vector<Index>& ray_bounds,
+                                 const GridIndexer& indexer,
+                                 grid_map::Matrix& data
+                                 )
+{
+  // mark, and collect the bounding box of all updated cells (in unwrapped indices)
+  Index dirty_min = Index::Constant(std::numeric_limits<int>::max());
+  Index dirty_max = Index::Constant(std::numeric_limits<int>::min());
+  for (const auto& bound : ray_bounds) {
+    if (bound(0) < 0) {
+      continue;
+    }
+    const Index unwrapped = indexer.getIndexFromBufferIndex(bound);
+    dirty_min = dirty_min.min(unwrapped);
+    dirty_max = dirty_max.max(unwrapped);
+  }
+  for (const auto& endpoint : endpoints) {
+    Index index;
+    if ((endpoint - origin).norm() > obstacle_range_ || !indexer.getIndexFromPosition(index, endpoint)) {
+      continue;
+    }
+    data(index(0), index(1)) = grid_map::LETHAL_OBSTACLE;
+    const Index unwrapped = indexer.getIndexFromBufferIndex(index);
+    dirty_min = dirty_min.min(unwrapped);
+    dirty_max = dirty_max.max(unwrapped);
+  }
+
+  if ((dirty_min > dirty_max).any()) {
+    dirty_start_index_.setZero();
+    dirty_size_.setZero();
+    return false;
+  }
+  dirty_start_index_ = indexer.getBufferIndexFromIndex(dirty_min);
+  dirty_size_ = dirty_max - dirty_min + 1;
+  return true;
+}
+
+bool MarkAndClear::operator()(const std::string& layer,
+                              const Position& origin,
+                              const std::vector<double>& ranges,
+                              RayTemplateCache& ray_templates,
+                              GridMap& cost_map
+                              )
+{
+  if (ranges.size() != ray_templates.getNumberOfBeams()) {
+    throw std::invalid_argument("MarkAndClear: the number of ranges does not match the number of beams.");
+  }
+  ray_templates.update(cost_map.getResolution());
+  grid_map::Matrix& data = cost_map.get(layer);
+  const GridIndexer& indexer = cost_map.getIndexer();
+
+  // beams without a return within the range of the templates are only cleared
+  std::vector<Position> endpoints;
+  endpoints.reserve(ranges.size());
+  for (size_t beam = 0; beam < ranges.size(); ++beam) {
+    if (ranges[beam] <= ray_templates.getMaxRange()) {
+      const double angle = ray_templates.getAngle(beam);
+      endpoints.push_back(origin + ranges[beam] * Vector(std::cos(angle), std::sin(angle)));
+    }
+  }
+
+  // the templates start at the center of the origin cell, which may be outside of the map
+  const Index origin_unwrapped = indexer.getIndexCoordinatesFromPosition(origin).floor().cast<int>();
+  const Index origin_buffer = indexer.getBufferIndexFromIndex(origin_unwrapped);
+  const Size& size = indexer.getSize();
+  const double half_cell = 0.5 * cost_map.getResolution();
+  const int number_of_rows = data.rows();
+  AtomicBitset cleared(static_cast<size_t>(data.rows()) * data.cols(), resolveNumberOfThreads(number_of_threads_) > 1);
+  std::vector<Index> ray_bounds(2 * ranges.size(), Index::Constant(-1));
+
+  parallelFor(0, ranges.size(), number_of_threads_, [&](const size_t beam) {
+    const double range = ranges[beam];
+    if (std::isnan(range)) {
+      return;
+    }
+    // a beam ending at its measurement keeps the cells around the end (it is marked),
+    // a range limited beam clears up to the range or the whole template
+    double limit = range - half_cell;
+    if (range > raytrace_range_ || range > ray_templates.getMaxRange()) {
+      limit = raytrace_range_ < ray_templates.getMaxRange() ? raytrace_range_ + half_cell
+                                                             : std::numeric_limits<double>::infinity();
+    }
+    const Index* offsets = ray_templates.getRayOffsets(beam);
+    const float* distances = ray_templates.getRayDistances(beam);
+    const size_t ray_size = ray_templates.getRaySize(beam);
+    Index first = Index::Constant(-1), last = Index::Constant(-1);
+    if (ray_size == 0) {
+      return;
+    }
+
+    // the cells of a template lie between the origin and its last offset, if they are all
+    // in the map and do not cross the wrap of the buffer, the cells are at fixed memory offsets
+    const Index end_offset = offsets[ray_size - 1];
+    const Index min_offset = end_offset.min(0), max_offset = end_offset.max(0);
+    if ((origin_unwrapped + min_offset >= 0).all() && (origin_unwrapped + max_offset < size).all()
+        && (origin_buffer + min_offset >= 0).all() && (origin_buffer + max_offset < size).all()) {
+      const size_t origin_linear = static_cast<size_t>(origin_buffer(1)) * number_of_rows + origin_buffer(0);
+      size_t i = 0;
+      for (; i < ray_size && distances[i] < limit; ++i) {
+        cleared.set(origin_linear + offsets[i](1) * number_of_rows + offsets[i](0));
+      }
+      if (i > 0) {
+        first = origin_buffer;
+        last = origin_buffer + offsets[i - 1];
+      }
+    } else {
+      for (size_t i = 0; i < ray_size && distances[i] < limit; ++i) {
+        const Index cell = origin_unwrapped + offsets[i];
+        if (cell(0) < 0 || cell(1) < 0 || cell(0) >= size(0) || cell(1) >= size(1)) {
+          continue;
+        }
+        last = indexer.getBufferIndexFromIndex(cell);
+        cleared.set(static_cast<size_t>(last(1)) * number_of_rows + last(0));
+        if (first(0) < 0) {
+          first = last;
+        }
+      }
+    }
+    ray_bounds[2 * beam] = first;
+    ray_bounds[2 * beam + 1] = last;
+  });
+
+  clearCells(cleared, clear_unknown_space_, number_of_threads_, data);
+  return markEndpoints(origin, endpoints, ray_bounds, indexer, data);
+}
+
+/*****************************************************************************
+** Trailers
+*****************************************************************************/
+
+} // namespace grid_map
@@ -0,0 +1,83 @@
+/**
+ * @file /cost_map_core/src/lib/operators/TrajectoryEvaluator.cpp
+ */
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include "grid_map/operators/TrajectoryEvaluator.hpp"
+#include <algorithm>
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace grid_map {
+
+/*****************************************************************************
+** Trajectory Evaluator
+*****************************************************************************/
+
+TrajectoryEvaluator::TrajectoryEvaluator(const Polygon& footprint, const unsigned int& number_of_headings)
+: footprint_checker_(footprint, number_of_headings)
+, stop_at_collision_(true)
+{
+}
+
+void TrajectoryEvaluator::setStopAtCollision(const bool& stop_at_collision)
+{
+  stop_at_collision_ = stop_at_collision;
+}
+
+void TrajectoryEvaluator::operator()(const std::string& layer,
+                                     const std::vector<Eigen::Matrix3Xd>& trajectories,
+                                     const GridMap& cost_map,
+                                     std::vector<TrajectoryCost>& costs,
+                                     ThreadPool& thread_pool)
+{
+  footprint_checker_.update(cost_map.getResolution());
+  const grid_map::Matrix& data = cost_map.get(layer);
+  const GridIndexer& indexer = cost_map.getIndexer();
+  costs.resize(trajectories.size());
+  thread_pool.run(trajectories.size(), [&](const size_t i, const unsigned int) {
+    costs[i] = evaluate(data, indexer, trajectories[i]);
+  });
+}
+
+TrajectoryCost TrajectoryEvaluator::operator()(const std::string& layer,
+                                               const Eigen::Ref<const Eigen::Matrix3Xd>& trajectory,
+                                               const GridMap& cost_map)
+{
+  footprint_checker_.update(cost_map.getResolution());
+  return evaluate(cost_map.get(layer), cost_map.getIndexer(), trajectory);
+}
+
+FootprintChecker& TrajectoryEvaluator::getFootprintChecker()
+{
+  return footprint_checker_;
+}
+
+TrajectoryCost TrajectoryEvaluator::evaluate(const grid_map::Matrix& data,
+                                             const GridIndexer& indexer,
+                                             const Eigen::Ref<const Eigen::Matrix3Xd>& trajectory) const
+{
+  const unsigned char lethal_cost = footprint_checker_.getLethalCost();
+  TrajectoryCost cost = {0, 0, -1, 0};
+  for (int i = 0; i < trajectory.cols(); ++i) {
+    const unsigned char pose_cost = footprint_checker_.getCost(data, indexer, Position(trajectory(0, i), trajectory(1, i)), trajectory(2, i));
+    cost.max_cost = std::max(cost.max_cost, pose_cost);
+    cost.sum_cost += pose_cost;
+    ++cost.number_of_poses;
+    if (pose_cost >= lethal_cost && cost.first_collision < 0) {
+      cost.first_collision = i;
+      if (stop_at_collision_) break;
+    }
+  }
+  return cost;
+}
+
+/*****************************************************************************
+** Trailers
+*****************************************************************************/
+
+} // namespace grid_map
@@ -0,0 +1,133 @@
+/*
+ * DirtyRegionQueue.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map/visualization/DirtyRegionQueue.hpp"
+
+#include <algorithm>
+
+namespace grid_map {
+
+namespace {
+
+bool contains(const BufferRegion& outer, const BufferRegion& inner)
+{
+  return (inner.getStartIndex() >= outer.getStartIndex()).all()
+      && (inner.getStartIndex() + inner.getSize() <= outer.getStartIndex() + outer.getSize()).all();
+}
+
+} // namespace
+
+DirtyRegions::DirtyRegions()
+    : bufferStartIndex(Index::Zero()),
+      isComplete(false),
+      nPosts(0)
+{
+}
+
+void DirtyRegions::clear()
+{
+  regions.clear();
+  isComplete = false;
+  nPosts = 0;
+  firstPostTime = Clock::time_point();
+}
+
+DirtyRegionQueue::DirtyRegionQueue(const size_t maxRegions)
+    : maxRegions_(std::max<size_t>(maxRegions, 1)),
+      isStopped_(false)
+{
+}
+
+void DirtyRegionQueue::post(const Index& bufferStartIndex, const std::vector<BufferRegion>& regions)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (isStopped_) return;
+    begin(bufferStartIndex);
+    for (const auto& region : regions) add(region);
+  }
+  condition_.notify_one();
+}
+
+void DirtyRegionQueue::post(const Index& bufferStartIndex, const BufferRegion& region)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (isStopped_) return;
+    begin(bufferStartIndex);
+    add(region);
+  }
+  condition_.notify_one();
+}
+
+void DirtyRegionQueue::postComplete(const Index& bufferStartIndex)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (isStopped_) return;
+    begin(bufferStartIndex);
+    pending_.isComplete = true;
+    pending_.regions.clear();
+  }
+  condition_.notify_one();
+}
+
+bool DirtyRegionQueue::take(DirtyRegions& dirtyRegions, const std::chrono::milliseconds& timeout)
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  condition_.wait_for(lock, timeout, [this]() { return isStopped_ || pending_.nPosts > 0; });
+  if (isStopped_ || pending_.nPosts == 0) return false;
+  dirtyRegions = pending_;
+  pending_.clear();
+  return true;
+}
+
+void DirtyRegionQueue::stop()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    isStopped_ = true;
+  }
+  condition_.notify_all();
+}
+
+bool DirtyRegionQueue::isStopped() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return isStopped_;
+}
+
+void DirtyRegionQueue::begin(const Index& bufferStartIndex)
+{
+  if (pending_.nPosts == 0) pending_.firstPostTime = DirtyRegions::Clock::now();
+  ++pending_.nPosts;
+  pending_.bufferStartIndex = bufferStartIndex;
+}
+
+void DirtyRegionQueue::add(const BufferRegion& region)
+{
+  if (pending_.isComplete || (region.getSize() <= 0).any()) return;
+  std::vector<BufferRegion>& regions = pending_.regions;
+  for (const auto& other : regions) {
+    if (contains(other, region)) return;
+  }
+  regions.erase(std::remove_if(regions.begin(), regions.end(),
+                               [&](const BufferRegion& other) { return contains(region, other); }),
+                regions.end());
+  regions.push_back(region);
+  if (regions.size() <= maxRegions_) return;
+
+  // Too many regions, merge them into their bounding box.
+  Index start = regions[0].getStartIndex();
+  Index end = start + regions[0].getSize();
+  for (const auto& other : regions) {
+    start = start.min(other.getStartIndex());
+    end = end.max(other.getStartIndex() + other.getSize());
+  }
+  regions.assign(1, BufferRegion(start, end - start, BufferRegion::Quadrant::Undefined));
+}
+
+} /* namespace grid_map */
@@ -0,0 +1,128 @@
+/*
+ * LayerImageRenderer.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map/visualization/LayerImageRenderer.hpp"
+#include "grid_map/GridMapMath.hpp"
+#include "grid_map/operators/Inflation.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace grid_map {
+
+ColorTable getDefaultCostColorTable()
+{
+  ColorTable colorTable;
+  for (int value = 0; value < 256; ++value) {
+    const uint32_t gray = static_cast<uint32_t>(value);
+    colorTable[value] = 0xff000000u | (gray << 16) | (gray << 8) | gray;
+  }
+  colorTable[INSCRIBED_OBSTACLE] = 0xffff8000u;
+  colorTable[LETHAL_OBSTACLE] = 0xffff0000u;
+  colorTable[NO_INFORMATION] = 0xff3050a0u;
+  return colorTable;
+}
+
+LayerImageRenderer::LayerImageRenderer(const ColorTable& colorTable)
+    : colorTable_(colorTable)
+{
+}
+
+void LayerImageRenderer::setColorTable(const ColorTable& colorTable)
+{
+  colorTable_ = colorTable;
+}
+
+const ColorTable& LayerImageRenderer::getColorTable() const
+{
+  return colorTable_;
+}
+
+void LayerImageRenderer::render(const Matrix& data, const Index& bufferStartIndex, uint32_t* image,
+                                const size_t bytesPerLine) const
+{
+  render(data, bufferStartIndex, Index(0, 0), Size(data.rows(), data.cols()), image, bytesPerLine);
+}
+
+void LayerImageRenderer::render(const Matrix& data, const Index& bufferStartIndex, const Index& startIndex,
+                                const Size& size, uint32_t* image, const size_t bytesPerLine) const
+{
+  renderRectangle(data, bufferStartIndex, startIndex, size, Index::Zero(), image, bytesPerLine);
+}
+
+void LayerImageRenderer::renderTile(const Matrix& data, const Index& bufferStartIndex, const Index& startIndex,
+                                    const Size& size, uint32_t* tile, const size_t bytesPerLine) const
+{
+  renderRectangle(data, bufferStartIndex, startIndex, size, startIndex, tile, bytesPerLine);
+}
+
+void LayerImageRenderer::renderRectangle(const Matrix& data, const Index& bufferStartIndex,
+                                         const Index& startIndex, const Size& size, const Index& imageIndex,
+                                         uint32_t* image, const size_t bytesPerLine) const
+{
+  assert(bytesPerLine % sizeof(uint32_t) == 0);
+  const Size bufferSize(data.rows(), data.cols());
+  const Index start = startIndex.max(Index::Zero());
+  const Size clippedSize = (startIndex + size).min(bufferSize) - start;
+  if ((clippedSize <= 0).any()) return;
+
+  // Split the rectangle at the wrap of the buffer, into up to four contiguous blocks.
+  const size_t pixelsPerLine = bytesPerLine / sizeof(uint32_t);
+  const Index bufferIndex = getBufferIndexFromIndex(start, bufferSize, bufferStartIndex);
+  const Size firstSize = clippedSize.min(bufferSize - bufferIndex);
+  for (int i = 0; i < 2; ++i) {
+    const int rowOffset = i == 0 ? 0 : firstSize(0);
+    const int nRows = i == 0 ? firstSize(0) : clippedSize(0) - firstSize(0);
+    if (nRows == 0) continue;
+    for (int j = 0; j < 2; ++j) {
+      const int columnOffset = j == 0 ? 0 : firstSize(1);
+      const int nColumns = j == 0 ? firstSize(1) : clippedSize(1) - firstSize(1);
+      if (nColumns == 0) continue;
+      const Index blockIndex(i == 0 ? bufferIndex(0) : 0, j == 0 ? bufferIndex(1) : 0);
+      uint32_t* pixel = image + (start(0) - imageIndex(0) + rowOffset) * pixelsPerLine
+          + start(1) - imageIndex(1) + columnOffset;
+      renderBlock(data, blockIndex, Size(nRows, nColumns), pixel, pixelsPerLine);
+    }
+  }
+}
+
+void LayerImageRenderer::render(const Matrix& data, const Index& bufferStartIndex, const BufferRegion& region,
+                                uint32_t* image, const size_t bytesPerLine) const
+{
+  // A region contiguous in the buffer may cross the edge of the map, split it there.
+  const Size bufferSize(data.rows(), data.cols());
+  const Index startIndex = getIndexFromBufferIndex(region.getStartIndex(), bufferSize, bufferStartIndex);
+  const Size size = region.getSize().min(bufferSize);
+  const Size firstSize = size.min(bufferSize - startIndex);
+  for (int i = 0; i < 2; ++i) {
+    for (int j = 0; j < 2; ++j) {
+      const Index pieceIndex(i == 0 ? startIndex(0) : 0, j == 0 ? startIndex(1) : 0);
+      const Size pieceSize(i == 0 ? firstSize(0) : size(0) - firstSize(0), j == 0 ? firstSize(1) : size(1) - firstSize(1));
+      render(data, bufferStartIndex, pieceIndex, pieceSize, image, bytesPerLine);
+    }
+  }
+}
+
+void LayerImageRenderer::renderBlock(const Matrix& data, const Index& bufferIndex, const Size& size,
+                                     uint32_t* pixel, const size_t pixelsPerLine) const
+{
+  // Tiles of 64 x 64 cells: 64 columns of the layer are read, 64 lines of the image written.
+  const int tileSize = 64;
+  const uint32_t* colors = colorTable_.data();
+  for (int row = 0; row < size(0); row += tileSize) {
+    const int rowEnd = std::min(size(0), row + tileSize);
+    for (int column = 0; column < size(1); column += tileSize) {
+      const int columnEnd = std::min(size(1), column + tileSize);
+      for (int c = column; c < columnEnd; ++c) {
+        const DataType* cells = &data(bufferIndex(0), bufferIndex(1) + c);
+        uint32_t* pixels = pixel + c;
+        for (int r = row; r < rowEnd; ++r) pixels[r * pixelsPerLine] = colors[cells[r]];
+      }
+    }
+  }
+}
+
+} /* namespace grid_map */
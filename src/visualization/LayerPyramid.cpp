@@ -0,0 +1,174 @@
+/*
+ * LayerPyramid.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map/visualization/LayerPyramid.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace grid_map {
+
+namespace {
+
+/*!
+ * Get the map order intervals [begin, end) of an interval of buffer indices, which
+ * are two if the interval crosses the wrap of the buffer.
+ */
+int unwrapInterval(const int begin, const int length, const int size, const int start,
+                   int intervals[2][2])
+{
+  const int first = ((begin - start) % size + size) % size;
+  intervals[0][0] = first;
+  intervals[0][1] = std::min(first + length, size);
+  if (first + length <= size) return 1;
+  intervals[1][0] = 0;
+  intervals[1][1] = first + length - size;
+  return 2;
+}
+
+} // namespace
+
+LayerPyramid::LayerPyramid(const int minSize)
+    : minSize_(std::max(minSize, 1)),
+      bufferStartIndex_(Index::Zero())
+{
+}
+
+void LayerPyramid::setLayer(const Matrix& data, const Index& bufferStartIndex)
+{
+  levels_.clear();
+  levels_.push_back(data);
+  bufferStartIndex_ = bufferStartIndex;
+  while (std::max(levels_.back().rows(), levels_.back().cols()) > minSize_) {
+    const Matrix& fine = levels_.back();
+    levels_.push_back(Matrix((fine.rows() + 1) / 2, (fine.cols() + 1) / 2));
+  }
+  poolAll();
+}
+
+void LayerPyramid::update(const Matrix& data, const Index& bufferStartIndex, const BufferRegion& region)
+{
+  if (isEmpty() || data.rows() != levels_[0].rows() || data.cols() != levels_[0].cols()) {
+    setLayer(data, bufferStartIndex);
+    return;
+  }
+  const bool moved = (bufferStartIndex != bufferStartIndex_).any();
+  bufferStartIndex_ = bufferStartIndex;
+
+  const Index start = region.getStartIndex().max(Index::Zero());
+  const Index end = (region.getStartIndex() + region.getSize()).min(getSize());
+  const bool isEmptyRegion = (end <= start).any();
+  if (!isEmptyRegion) {
+    levels_[0].block(start(0), start(1), end(0) - start(0), end(1) - start(1)) =
+        data.block(start(0), start(1), end(0) - start(0), end(1) - start(1));
+  }
+
+  // All cells of the coarse levels are shown at other map indices after a move.
+  if (moved) {
+    poolAll();
+    return;
+  }
+  if (isEmptyRegion) return;
+
+  // The region in map order, then the cells of level k covering it at level k - 1.
+  int rows[2][2], columns[2][2];
+  const Size size = getSize();
+  const int nRows = unwrapInterval(start(0), end(0) - start(0), size(0), bufferStartIndex_(0), rows);
+  const int nColumns = unwrapInterval(start(1), end(1) - start(1), size(1), bufferStartIndex_(1), columns);
+  for (int i = 0; i < nRows; ++i) {
+    for (int j = 0; j < nColumns; ++j) {
+      Index first(rows[i][0], columns[j][0]);
+      Index last(rows[i][1], columns[j][1]);
+      for (size_t level = 1; level < levels_.size(); ++level) {
+        first = first / 2;
+        last = (last - 1) / 2 + 1;
+        pool(level, first, last - first);
+      }
+    }
+  }
+}
+
+void LayerPyramid::clear()
+{
+  levels_.clear();
+  bufferStartIndex_.setZero();
+}
+
+bool LayerPyramid::isEmpty() const
+{
+  return levels_.empty();
+}
+
+size_t LayerPyramid::getNumberOfLevels() const
+{
+  return levels_.size();
+}
+
+const Matrix& LayerPyramid::getLevel(const size_t level) const
+{
+  return levels_[level];
+}
+
+Size LayerPyramid::getSize(const size_t level) const
+{
+  if (level >= levels_.size()) return Size::Zero();
+  return Size(levels_[level].rows(), levels_[level].cols());
+}
+
+Index LayerPyramid::getBufferStartIndex(const size_t level) const
+{
+  return level == 0 ? bufferStartIndex_ : Index::Zero();
+}
+
+size_t LayerPyramid::getLevelForScale(const double pixelsPerCell) const
+{
+  if (levels_.size() < 2 || pixelsPerCell >= 1.0 || pixelsPerCell <= 0.0) return 0;
+  const double level = std::ceil(std::log2(1.0 / pixelsPerCell) - 1e-9);
+  return std::min(static_cast<size_t>(level), levels_.size() - 1);
+}
+
+void LayerPyramid::poolAll()
+{
+  for (size_t level = 1; level < levels_.size(); ++level) {
+    pool(level, Index::Zero(), getSize(level));
+  }
+}
+
+void LayerPyramid::pool(const size_t level, const Index& index, const Size& size)
+{
+  assert(level > 0 && level < levels_.size());
+  const Matrix& fine = levels_[level - 1];
+  Matrix& coarse = levels_[level];
+  const Index fineStart = getBufferStartIndex(level - 1);
+  const int nRows = fine.rows();
+  const int nColumns = fine.cols();
+  const int rowBegin = 2 * index(0);
+  const int rowEnd = std::min(2 * (index(0) + size(0)), nRows);
+  // Map rows before the split are at buffer row i + start, the others wrapped around.
+  const int rowSplit = std::min(rowEnd, std::max(rowBegin, nRows - fineStart(0)));
+  columnMax_.resize(rowEnd - rowBegin);
+
+  // Maximum over the two columns (contiguous), then over pairs of rows.
+  for (int j = index(1); j < index(1) + size(1); ++j) {
+    const int firstColumn = (2 * j + fineStart(1)) % nColumns;
+    const int secondColumn = (std::min(2 * j + 1, nColumns - 1) + fineStart(1)) % nColumns;
+    const DataType* first = &fine(0, firstColumn);
+    const DataType* second = &fine(0, secondColumn);
+    for (int i = rowBegin; i < rowSplit; ++i) {
+      columnMax_[i - rowBegin] = std::max(first[i + fineStart(0)], second[i + fineStart(0)]);
+    }
+    for (int i = rowSplit; i < rowEnd; ++i) {
+      columnMax_[i - rowBegin] = std::max(first[i + fineStart(0) - nRows], second[i + fineStart(0) - nRows]);
+    }
+    DataType* cells = &coarse(0, j);
+    for (int i = index(0); i < index(0) + size(0); ++i) {
+      cells[i] = std::max(columnMax_[2 * i - rowBegin], columnMax_[std::min(2 * i + 1, rowEnd - 1) - rowBegin]);
+    }
+  }
+}
+
+} /* namespace grid_map */
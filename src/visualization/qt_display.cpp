@@ -3,6 +3,8 @@
 #include <QAction>
 #include <QScreen>
 #include <QDebug>
+#include <QPaintEvent>
+#include <algorithm>
 
 ImageViewer::ImageViewer()
    : image_widget_(new NonAntiAliasImage(this) )
@@ -18,19 +20,47 @@ ImageViewer::ImageViewer()
 
 bool ImageViewer::load(const grid_map::Matrix &matrix )
 {
-    grid_map::Matrix transposed = matrix.transpose();
-    QImage newImage( QSize(matrix.cols(), matrix.rows()), QImage::Format_Grayscale8 );
-    memcpy( newImage.bits(), transposed.data(), transposed.size() );
-    setImage(newImage);
+    return load(matrix, grid_map::Index::Zero());
+}
+
+bool ImageViewer::load(const grid_map::GridMap& map, const std::string& layer)
+{
+    return load(map.get(layer), map.getStartIndex());
+}
+
+bool ImageViewer::load(const grid_map::Matrix& matrix, const grid_map::Index& buffer_start_index)
+{
+    image_widget_->setLayer( matrix, buffer_start_index );
+    resetScale();
+    return true;
+}
+
+bool ImageViewer::updateRegions(const grid_map::GridMap& map, const std::string& layer,
+                                const std::vector<grid_map::BufferRegion>& dirty_regions)
+{
+    const grid_map::Matrix& matrix = map.get(layer);
+    if( image_widget_->imageSize() != QSize(matrix.cols(), matrix.rows()) )
+    {
+        return load(map, layer);
+    }
+    image_widget_->updateLayer( matrix, map.getStartIndex(), dirty_regions );
     return true;
 }
 
-void ImageViewer::setImage(const QImage &newImage)
+void ImageViewer::setColorTable(const grid_map::ColorTable& color_table)
+{
+    image_widget_->setColorTable(color_table);
+}
+
+NonAntiAliasImage* ImageViewer::imageWidget() const
+{
+    return image_widget_;
+}
+
+void ImageViewer::resetScale()
 {
-    image = newImage;
-    image_widget_->setPixmap(QPixmap::fromImage(image));
     scaleFactor = 1.0;
-    QSize size = image_widget_->pixmap().size();
+    QSize size = image_widget_->imageSize();
     resize( size * 2 );
     image_widget_->resize( size );
 }
@@ -38,9 +68,9 @@ void ImageViewer::setImage(const QImage &newImage)
 
 void ImageViewer::scaleImage(double factor)
 {
-    Q_ASSERT(image_widget_->pixmap());
+    Q_ASSERT(!image_widget_->imageSize().isEmpty());
     scaleFactor *= factor;
-    image_widget_->resize(scaleFactor * image_widget_->pixmap().size());
+    image_widget_->resize(scaleFactor * image_widget_->imageSize());
 
     adjustScrollBar(horizontalScrollBar(), factor);
     adjustScrollBar(verticalScrollBar(), factor);
@@ -63,21 +93,328 @@ void ImageViewer::wheelEvent(QWheelEvent *event)
     }
 }
 
-const QPixmap &NonAntiAliasImage::pixmap() const
+namespace {
+
+// side length of the tiles in cells of their level
+const int TILE_SIZE = 256;
+
+// tiles kept in the cache, in KiB
+const int TILE_CACHE_SIZE = 256 * 1024;
+
+quint64 tileKey(int level, int row, int column)
+{
+    return (quint64(level) << 48) | (quint64(row) << 24) | quint64(column);
+}
+
+// the unwrapped intervals [begin, end) of an interval of buffer indices [begin, begin + length)
+int unwrapInterval(int begin, int length, int size, int start, int intervals[2][2])
+{
+    const int first = ((begin - start) % size + size) % size;
+    intervals[0][0] = first;
+    intervals[0][1] = std::min(first + length, size);
+    if( first + length <= size ) return 1;
+    intervals[1][0] = 0;
+    intervals[1][1] = first + length - size;
+    return 2;
+}
+
+} // namespace
+
+NonAntiAliasImage::NonAntiAliasImage(QWidget* parent)
+    : QWidget(parent)
+    , m_tiles(TILE_CACHE_SIZE)
+    , m_pending_clear(false)
+    , m_update_posted(false)
+{}
+
+QSize NonAntiAliasImage::imageSize() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const grid_map::Size size = m_pyramid.getSize();
+    return QSize(size(1), size(0));
+}
+
+void NonAntiAliasImage::setLayer(const grid_map::Matrix& data, const grid_map::Index& buffer_start_index)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pyramid.setLayer(data, buffer_start_index);
+        m_pending_regions.clear();
+        m_pending_clear = false;
+    }
+    m_tiles.clear();
+    update();
+}
+
+void NonAntiAliasImage::updateLayer(const grid_map::Matrix& data, const grid_map::Index& buffer_start_index,
+                                    const std::vector<grid_map::BufferRegion>& dirty_regions,
+                                    const std::chrono::steady_clock::time_point& posted)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const bool moved = (buffer_start_index != m_pyramid.getBufferStartIndex()).any();
+    for( const auto& region: dirty_regions )
+    {
+        m_pyramid.update(data, buffer_start_index, region);
+    }
+    if( dirty_regions.empty() && moved )
+    {
+        m_pyramid.update(data, buffer_start_index, grid_map::BufferRegion());
+    }
+
+    // after a move all cells are shown at other pixels
+    m_pending_clear = m_pending_clear || moved;
+    if( m_pending_clear )
+    {
+        m_pending_regions.clear();
+    }
+    else
+    {
+        m_pending_regions.insert(m_pending_regions.end(), dirty_regions.begin(), dirty_regions.end());
+    }
+    if( m_pending_posted == std::chrono::steady_clock::time_point() )
+    {
+        m_pending_posted = posted;
+    }
+
+    // one queued call for all updates until the GUI thread gets to it
+    if( !m_update_posted )
+    {
+        m_update_posted = true;
+        QMetaObject::invokeMethod(this, "applyUpdates", Qt::QueuedConnection);
+    }
+}
+
+void NonAntiAliasImage::applyUpdates()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if( m_pending_clear )
+        {
+            m_tiles.clear();
+        }
+        for( const auto& region: m_pending_regions )
+        {
+            invalidateTiles(region);
+        }
+        m_pending_regions.clear();
+        m_pending_clear = false;
+        m_update_posted = false;
+        if( m_unpainted_posted == std::chrono::steady_clock::time_point() )
+        {
+            m_unpainted_posted = m_pending_posted;
+        }
+        m_pending_posted = std::chrono::steady_clock::time_point();
+    }
+    update();
+}
+
+NonAntiAliasImage::Latency NonAntiAliasImage::takeLatency()
 {
-    return m_pixmap;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const Latency latency = m_latency;
+    m_latency = Latency();
+    return latency;
 }
 
-void NonAntiAliasImage::setPixmap(const QPixmap &px)
+void NonAntiAliasImage::setColorTable(const grid_map::ColorTable& color_table)
 {
-    m_pixmap = px;
+    m_renderer.setColorTable(color_table);
+    m_tiles.clear();
     update();
 }
 
-void NonAntiAliasImage::paintEvent(QPaintEvent *)
+const QPixmap* NonAntiAliasImage::tile(int level, int row, int column)
 {
+    const quint64 key = tileKey(level, row, column);
+    if( const QPixmap* cached = m_tiles.object(key) )
+    {
+        return cached;
+    }
+
+    const grid_map::Index start(row * TILE_SIZE, column * TILE_SIZE);
+    const grid_map::Size size = grid_map::Size(TILE_SIZE, TILE_SIZE).min(m_pyramid.getSize(level) - start);
+    QImage image( QSize(size(1), size(0)), QImage::Format_RGB32 );
+    m_renderer.renderTile( m_pyramid.getLevel(level), m_pyramid.getBufferStartIndex(level), start, size,
+                           reinterpret_cast<uint32_t*>(image.bits()), image.bytesPerLine() );
+    QPixmap* pixmap = new QPixmap( QPixmap::fromImage(image) );
+    m_tiles.insert( key, pixmap, std::max(1, size(0) * size(1) * 4 / 1024) );
+    return pixmap;
+}
+
+void NonAntiAliasImage::invalidateTiles(const grid_map::BufferRegion& region)
+{
+    const grid_map::Index first = region.getStartIndex().max(grid_map::Index::Zero());
+    const grid_map::Index last = (region.getStartIndex() + region.getSize() - 1).min(m_pyramid.getSize() - 1);
+    if( (last < first).any() )
+    {
+        return;
+    }
+    // the region in map order, in up to 2 x 2 rectangles, the coarse levels are in map order too
+    const grid_map::Size size = m_pyramid.getSize();
+    const grid_map::Index start = m_pyramid.getBufferStartIndex();
+    int rows[2][2], columns[2][2];
+    const int n_rows = unwrapInterval(first(0), last(0) - first(0) + 1, size(0), start(0), rows);
+    const int n_columns = unwrapInterval(first(1), last(1) - first(1) + 1, size(1), start(1), columns);
+    for( size_t level = 0; level < m_pyramid.getNumberOfLevels(); level++ )
+    {
+        for( int i = 0; i < n_rows; i++ )
+        {
+            for( int j = 0; j < n_columns; j++ )
+            {
+                // the tiles of the cells of the level covering the rectangle
+                const int first_row = (rows[i][0] >> level) / TILE_SIZE;
+                const int last_row = ((rows[i][1] - 1) >> level) / TILE_SIZE;
+                const int first_column = (columns[j][0] >> level) / TILE_SIZE;
+                const int last_column = ((columns[j][1] - 1) >> level) / TILE_SIZE;
+                for( int row = first_row; row <= last_row; row++ )
+                {
+                    for( int column = first_column; column <= last_column; column++ )
+                    {
+                        m_tiles.remove( tileKey(level, row, column) );
+                    }
+                }
+            }
+        }
+    }
+}
+
+void NonAntiAliasImage::paintEvent(QPaintEvent* event)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if( m_pyramid.isEmpty() || width() == 0 || height() == 0 )
+    {
+        return;
+    }
     QPainter painter(this);
     painter.setRenderHint(QPainter::Antialiasing, false);
-    style()->drawItemPixmap(&painter, rect(), Qt::AlignCenter,
-                            m_pixmap.scaled(rect().size()));
+    painter.setRenderHint(QPainter::SmoothPixmapTransform, false);
+
+    // the layer is stretched over the whole widget, cells of the level are
+    // at least a pixel large such that max-pooling keeps every obstacle visible
+    const grid_map::Size size = m_pyramid.getSize();
+    const double scale_x = double(width()) / size(1);
+    const double scale_y = double(height()) / size(0);
+    const size_t level = m_pyramid.getLevelForScale( std::min(scale_x, scale_y) );
+    const grid_map::Size level_size = m_pyramid.getSize(level);
+    const double cell_width = scale_x * (1 << level);
+    const double cell_height = scale_y * (1 << level);
+
+    // only the tiles in the exposed part of the widget (the viewport of the scroll area)
+    const QRect exposed = event->rect().intersected(rect());
+    const int first_row = int(exposed.top() / cell_height) / TILE_SIZE;
+    const int last_row = std::min( int(exposed.bottom() / cell_height) / TILE_SIZE, (level_size(0) - 1) / TILE_SIZE );
+    const int first_column = int(exposed.left() / cell_width) / TILE_SIZE;
+    const int last_column = std::min( int(exposed.right() / cell_width) / TILE_SIZE, (level_size(1) - 1) / TILE_SIZE );
+
+    for( int row = first_row; row <= last_row; row++ )
+    {
+        for( int column = first_column; column <= last_column; column++ )
+        {
+            const QPixmap* pixmap = tile(level, row, column);
+            // rounded edges, such that neighbouring tiles neither overlap nor leave gaps
+            const int left = qRound( column * TILE_SIZE * cell_width );
+            const int top = qRound( row * TILE_SIZE * cell_height );
+            const int right = qRound( (column * TILE_SIZE + pixmap->width()) * cell_width );
+            const int bottom = qRound( (row * TILE_SIZE + pixmap->height()) * cell_height );
+            painter.drawPixmap( QRect(left, top, right - left, bottom - top), *pixmap );
+        }
+    }
+
+    if( m_unpainted_posted != std::chrono::steady_clock::time_point() )
+    {
+        const double latency_ms = std::chrono::duration<double, std::milli>(
+                                      std::chrono::steady_clock::now() - m_unpainted_posted).count();
+        m_latency.count++;
+        m_latency.sum_ms += latency_ms;
+        m_latency.max_ms = std::max(m_latency.max_ms, latency_ms);
+        m_unpainted_posted = std::chrono::steady_clock::time_point();
+    }
+}
+
+LiveView::LiveView(ImageViewer* viewer, const grid_map::GridMap& map, const std::string& layer,
+                   std::mutex& map_mutex, double max_rate)
+    : image_widget_(viewer->imageWidget())
+    , map_(map)
+    , layer_(layer)
+    , map_mutex_(map_mutex)
+    , period_(std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                  std::chrono::duration<double>(1.0 / max_rate)))
+    , frames_(0)
+    , posts_(0)
+{
+    {
+        std::lock_guard<std::mutex> lock(map_mutex_);
+        layer_copy_ = map_.get(layer_);
+        viewer->load(map_, layer_);
+    }
+    thread_ = std::thread(&LiveView::run, this);
+}
+
+LiveView::~LiveView()
+{
+    queue_.stop();
+    thread_.join();
+}
+
+grid_map::DirtyRegionQueue& LiveView::queue()
+{
+    return queue_;
+}
+
+size_t LiveView::frames() const
+{
+    return frames_;
+}
+
+size_t LiveView::posts() const
+{
+    return posts_;
+}
+
+void LiveView::run()
+{
+    grid_map::DirtyRegions dirty_regions;
+    std::chrono::steady_clock::time_point next_frame = std::chrono::steady_clock::now();
+    while( !queue_.isStopped() )
+    {
+        // throttled: posts until the next frame are coalesced in the queue
+        std::this_thread::sleep_until(next_frame);
+        if( !queue_.take(dirty_regions, std::chrono::milliseconds(100)) )
+        {
+            continue;
+        }
+        next_frame = std::chrono::steady_clock::now() + period_;
+
+        // the writer only waits for the copy of the changed cells
+        grid_map::Index buffer_start_index;
+        {
+            std::lock_guard<std::mutex> lock(map_mutex_);
+            const grid_map::Matrix& data = map_.get(layer_);
+            buffer_start_index = map_.getStartIndex();
+            if( dirty_regions.isComplete || data.rows() != layer_copy_.rows() || data.cols() != layer_copy_.cols() )
+            {
+                layer_copy_ = data;
+                dirty_regions.regions.assign(1, grid_map::BufferRegion(grid_map::Index::Zero(),
+                                                                       grid_map::Size(data.rows(), data.cols()),
+                                                                       grid_map::BufferRegion::Quadrant::Undefined));
+            }
+            else
+            {
+                for( const auto& region: dirty_regions.regions )
+                {
+                    const grid_map::Index start = region.getStartIndex().max(grid_map::Index::Zero());
+                    const grid_map::Index end = (region.getStartIndex() + region.getSize()).min(
+                                                    grid_map::Size(data.rows(), data.cols()));
+                    if( (end <= start).any() ) continue;
+                    layer_copy_.block(start(0), start(1), end(0) - start(0), end(1) - start(1)) =
+                        data.block(start(0), start(1), end(0) - start(0), end(1) - start(1));
+                }
+            }
+        }
+
+        image_widget_->updateLayer( layer_copy_, buffer_start_index, dirty_regions.regions,
+                                    dirty_regions.firstPostTime );
+        frames_++;
+        posts_ += dirty_regions.nPosts;
+    }
 }
@@ -0,0 +1,98 @@
+/*
+ * CircleIteratorTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map/iterators/CircleIterator.hpp"
+#include "grid_map/iterators/SubmapIterator.hpp"
+#include "grid_map/GridMap.hpp"
+
+// Eigen
+#include <Eigen/Core>
+
+// gtest
+#include <gtest/gtest.h>
+
+// STL
+#include <memory>
+#include <vector>
+
+using namespace std;
+using namespace grid_map;
+
+TEST(CircleIterator, InsideCellsInOrder)
+{
+  GridMap map({"types"});
+  map.setGeometry(Length(8.0, 5.0), 0.5, Position(0.0, 0.0)); // bufferSize(16, 10)
+  map.move(Position(-1.5, 0.5));
+
+  const Position center(-2.0, 0.8);
+  const double radius = 1.6;
+  std::vector<grid_map::Index> expected;
+  for (SubmapIterator iterator(map, map.getStartIndex(), map.getSize()); !iterator.isPastEnd(); ++iterator) {
+    Position position;
+    map.getPosition(*iterator, position);
+    if ((position - center).squaredNorm() <= radius * radius) expected.push_back(*iterator);
+  }
+  std::vector<grid_map::Index> cells;
+  for (CircleIterator iterator(map, center, radius); !iterator.isPastEnd(); ++iterator) {
+    cells.push_back(*iterator);
+  }
+
+  ASSERT_FALSE(expected.empty());
+  ASSERT_EQ(expected.size(), cells.size());
+  for (size_t i = 0; i < cells.size(); ++i) {
+    EXPECT_EQ(expected[i](0), cells[i](0));
+    EXPECT_EQ(expected[i](1), cells[i](1));
+  }
+}
+
+TEST(CircleIterator, Spans)
+{
+  GridMap map({"iterator", "spans"});
+  map.setGeometry(Length(8.0, 5.0), 0.5, Position(0.0, 0.0));
+  map.move(Position(-1.5, 0.5));
+  map["iterator"].setZero();
+  map["spans"].setZero();
+
+  CircleIterator iterator(map, Position(-3.2, 1.1), 2.0); // Partially outside of the map.
+  std::vector<Span> spans;
+  iterator.getSpans(spans);
+  for (; !iterator.isPastEnd(); ++iterator) {
+    map.at("iterator", *iterator) += 1;
+  }
+  for (const auto& span : spans) {
+    span.segment(map["spans"]).array() += 1;
+  }
+  EXPECT_GT(map["iterator"].cast<int>().sum(), 0);
+  EXPECT_TRUE((map["iterator"].array() == map["spans"].array()).all());
+}
+
+TEST(CircleIterator, OutsideMap)
+{
+  GridMap map({"types"});
+  map.setGeometry(Length(8.0, 5.0), 1.0, Position(0.0, 0.0));
+  CircleIterator iterator(map, Position(10.0, 10.0), 1.0);
+  EXPECT_TRUE(iterator.isPastEnd());
+}
+
+TEST(CircleIterator, GeometryAtConstruction)
+{
+  GridMap map({"types"});
+  map.setGeometry(Length(8.0, 5.0), 0.5, Position(0.0, 0.0));
+  std::vector<Index> expected;
+  for (CircleIterator iterator(map, Position(-1.0, 0.5), 1.6); !iterator.isPastEnd(); ++iterator) {
+    expected.push_back(*iterator);
+  }
+
+  // Moving or destroying the map does not change the cells of an existing iterator.
+  std::unique_ptr<GridMap> movedMap(new GridMap(map));
+  CircleIterator iterator(*movedMap, Position(-1.0, 0.5), 1.6);
+  movedMap->move(Position(1.5, -1.0));
+  movedMap.reset();
+  std::vector<Index> cells;
+  for (; !iterator.isPastEnd(); ++iterator) cells.push_back(*iterator);
+  ASSERT_EQ(expected.size(), cells.size());
+  for (size_t i = 0; i < cells.size(); ++i) EXPECT_TRUE((expected[i] == cells[i]).all());
+}
@@ -0,0 +1,115 @@
+/*
+ * CostStatisticsTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map/operators/CostStatistics.hpp"
+#include "grid_map/iterators/SubmapIterator.hpp"
+#include "grid_map/iterators/CircleIterator.hpp"
+#include "grid_map/GridMap.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+// STL
+#include <cstdlib>
+#include <vector>
+
+using namespace grid_map;
+
+namespace {
+
+template<typename Iterator>
+void expectMatches(const CostStatistics& statistics, const CostHistogram& histogram, const GridMap& map,
+                   Iterator iterator, const unsigned char unknown, const unsigned char lethal)
+{
+  CostStatistics expected;
+  CostHistogram expectedHistogram;
+  expectedHistogram.fill(0);
+  for (; !iterator.isPastEnd(); ++iterator) {
+    const unsigned char cost = map.at("costs", *iterator);
+    ++expectedHistogram[cost];
+    if (cost == unknown) {
+      ++expected.number_of_unknown;
+      continue;
+    }
+    ++expected.number_of_known;
+    expected.sum += cost;
+    expected.min = std::min(expected.min, cost);
+    expected.max = std::max(expected.max, cost);
+    if (cost >= lethal) ++expected.number_of_lethal;
+  }
+  EXPECT_EQ(expected.number_of_known, statistics.number_of_known);
+  EXPECT_EQ(expected.number_of_unknown, statistics.number_of_unknown);
+  EXPECT_EQ(expected.number_of_lethal, statistics.number_of_lethal);
+  EXPECT_EQ(expected.sum, statistics.sum);
+  EXPECT_EQ(expected.min, statistics.min);
+  EXPECT_EQ(expected.max, statistics.max);
+  EXPECT_DOUBLE_EQ(expected.mean(), statistics.mean());
+  EXPECT_DOUBLE_EQ(expected.lethalFraction(), statistics.lethalFraction());
+  EXPECT_EQ(expectedHistogram, histogram);
+}
+
+} // namespace
+
+TEST(CostStatistics, MatchesIteration)
+{
+  GridMap map({"costs"});
+  map.setGeometry(Length(20.0, 15.0), 0.05, Position(0.0, 0.0));
+  map.move(Position(3.21, -1.7));
+  srand(1);
+  for (int i = 0; i < map["costs"].size(); ++i) {
+    const int r = rand() % 10;
+    map["costs"](i) = r == 0 ? NO_INFORMATION : (r == 1 ? LETHAL_OBSTACLE : rand() % 200);
+  }
+
+  for (const unsigned char unknown : {NO_INFORMATION, FREE_SPACE}) {
+    const CostStatisticsComputer computer(unknown, 180);
+    CostHistogram histogram;
+
+    // whole layer
+    computer.histogram(map["costs"], histogram);
+    expectMatches(computer(map["costs"]), histogram, map, GridMapIterator(map), unknown, 180);
+
+    // submap across the wrap of the buffer
+    Index start;
+    ASSERT_TRUE(map.getIndex(Position(4.0, 2.0), start));
+    const Size size(150, 120);
+    computer.histogram("costs", start, size, map, histogram);
+    expectMatches(computer("costs", start, size, map), histogram, map,
+                  SubmapIterator(map, start, size), unknown, 180);
+
+    // buffer region
+    const BufferRegion region(Index(10, 20), Size(30, 40), BufferRegion::Quadrant::Undefined);
+    computer.histogram(map["costs"], region, histogram);
+    expectMatches(computer(map["costs"], region), histogram, map,
+                  SubmapIterator(map, region), unknown, 180);
+
+    // spans of a shape
+    std::vector<Span> spans;
+    CircleIterator(map, Position(-1.0, 1.0), 3.3).getSpans(spans);
+    computer.histogram(map["costs"], spans, histogram);
+    expectMatches(computer(map["costs"], spans), histogram, map,
+                  CircleIterator(map, Position(-1.0, 1.0), 3.3), unknown, 180);
+  }
+
+  // merging, and regions without known cells
+  const CostStatisticsComputer computer;
+  map["costs"].setConstant(NO_INFORMATION);
+  CostStatistics statistics = computer(map["costs"]);
+  EXPECT_EQ(0u, statistics.number_of_known);
+  EXPECT_EQ(0.0, statistics.mean());
+  EXPECT_EQ(0.0, statistics.lethalFraction());
+  map["costs"].block(0, 0, 10, 10).setConstant(LETHAL_OBSTACLE);
+  map["costs"].block(10, 0, 10, 10).setConstant(FREE_SPACE);
+  statistics = computer(map["costs"], BufferRegion(Index(0, 0), Size(10, 10), BufferRegion::Quadrant::Undefined));
+  statistics += computer(map["costs"], BufferRegion(Index(10, 0), Size(10, 10), BufferRegion::Quadrant::Undefined));
+  EXPECT_EQ(200u, statistics.number_of_known);
+  EXPECT_EQ(0.5, statistics.lethalFraction());
+  EXPECT_EQ(LETHAL_OBSTACLE / 2.0, statistics.mean());
+  EXPECT_EQ(FREE_SPACE, statistics.min);
+  EXPECT_EQ(LETHAL_OBSTACLE, statistics.max);
+
+  EXPECT_THROW(computer("costs", Index(0, 0), Size(1000, 10), map), std::out_of_range);
+}
@@ -0,0 +1,92 @@
+/*
+ * DirtyRegionQueueTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map/visualization/DirtyRegionQueue.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+// STL
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace grid_map;
+
+namespace {
+
+BufferRegion region(const int row, const int column, const int nRows, const int nColumns)
+{
+  return BufferRegion(Index(row, column), Size(nRows, nColumns), BufferRegion::Quadrant::Undefined);
+}
+
+} // namespace
+
+TEST(DirtyRegionQueue, Coalescing)
+{
+  DirtyRegionQueue queue(3);
+  DirtyRegions dirtyRegions;
+  EXPECT_FALSE(queue.take(dirtyRegions, std::chrono::milliseconds(1)));
+
+  queue.post(Index(1, 2), region(10, 10, 5, 5));
+  queue.post(Index(1, 3), region(11, 11, 2, 2)); // covered
+  queue.post(Index(1, 4), std::vector<BufferRegion>{region(0, 0, 20, 20), region(30, 0, 1, 100)}); // covers the first
+  queue.post(Index(1, 5), region(0, 0, 0, 10)); // empty
+  ASSERT_TRUE(queue.take(dirtyRegions, std::chrono::milliseconds(0)));
+  EXPECT_EQ(4u, dirtyRegions.nPosts);
+  EXPECT_FALSE(dirtyRegions.isComplete);
+  EXPECT_TRUE((dirtyRegions.bufferStartIndex == Index(1, 5)).all());
+  ASSERT_EQ(2u, dirtyRegions.regions.size());
+  EXPECT_TRUE((dirtyRegions.regions[0].getSize() == Size(20, 20)).all());
+  EXPECT_TRUE((dirtyRegions.regions[1].getStartIndex() == Index(30, 0)).all());
+  EXPECT_FALSE(queue.take(dirtyRegions, std::chrono::milliseconds(0)));
+
+  // More than three regions are merged into their bounding box.
+  for (int i = 0; i < 4; ++i) queue.post(Index(0, 0), region(10 * i, 5, 2, 3 + i));
+  ASSERT_TRUE(queue.take(dirtyRegions, std::chrono::milliseconds(0)));
+  ASSERT_EQ(1u, dirtyRegions.regions.size());
+  EXPECT_TRUE((dirtyRegions.regions[0].getStartIndex() == Index(0, 5)).all());
+  EXPECT_TRUE((dirtyRegions.regions[0].getSize() == Size(32, 6)).all());
+
+  // A complete change makes regions obsolete.
+  queue.post(Index(0, 0), region(1, 1, 1, 1));
+  queue.postComplete(Index(2, 2));
+  queue.post(Index(3, 3), region(1, 1, 1, 1));
+  ASSERT_TRUE(queue.take(dirtyRegions, std::chrono::milliseconds(0)));
+  EXPECT_TRUE(dirtyRegions.isComplete);
+  EXPECT_TRUE(dirtyRegions.regions.empty());
+  EXPECT_EQ(3u, dirtyRegions.nPosts);
+}
+
+TEST(DirtyRegionQueue, Threads)
+{
+  DirtyRegionQueue queue;
+  const size_t nPosts = 10000;
+  std::thread writer([&]() {
+    for (size_t i = 0; i < nPosts; ++i) queue.post(Index(0, 0), region(i % 100, 0, 1, 50));
+  });
+
+  size_t nTaken = 0;
+  DirtyRegions dirtyRegions;
+  while (nTaken < nPosts && queue.take(dirtyRegions, std::chrono::milliseconds(1000))) {
+    EXPECT_LE(dirtyRegions.regions.size(), 32u);
+    EXPECT_LE(dirtyRegions.firstPostTime, DirtyRegions::Clock::now());
+    nTaken += dirtyRegions.nPosts;
+  }
+  writer.join();
+  EXPECT_EQ(nPosts, nTaken);
+
+  // Stopping wakes up a waiting reader.
+  std::thread stopper([&]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    queue.stop();
+  });
+  EXPECT_FALSE(queue.take(dirtyRegions, std::chrono::milliseconds(10000)));
+  stopper.join();
+  EXPECT_TRUE(queue.isStopped());
+  queue.post(Index(0, 0), region(0, 0, 1, 1));
+  EXPECT_FALSE(queue.take(dirtyRegions, std::chrono::milliseconds(0)));
+}
@@ -112,3 +112,75 @@ TEST(EigenMatrixBaseAddons, clamp)
   EXPECT_TRUE(std::isnan(matrix(1, 1)));
   EXPECT_NEAR(7.0, matrix(2, 2), 1e-7);
 }
+
+TEST(EigenMatrixBaseAddons, vectorizedReductionsOfFinites)
+{
+  // Sizes around the packet sizes, such that both the packet and the scalar tails are used.
+  for (int size = 1; size < 40; ++size) {
+    Eigen::VectorXf vector(Eigen::VectorXf::Random(size));
+    Eigen::VectorXd vectorDouble(vector.cast<double>());
+    float sum = 0.0, min = INFINITY, max = -INFINITY;
+    int nFinites = 0;
+    for (int i = 0; i < size; ++i) {
+      if (i % 3 == 1) vector(i) = i % 2 == 0 ? INFINITY : NAN;
+      if (i % 5 == 2) vector(i) = -INFINITY;
+      vectorDouble(i) = vector(i);
+      if (!std::isfinite(vector(i))) continue;
+      sum += vector(i);
+      min = std::min(min, vector(i));
+      max = std::max(max, vector(i));
+      ++nFinites;
+    }
+    if (nFinites == 0) continue;
+    EXPECT_NEAR(sum, vector.sumOfFinites(), 1e-5) << size;
+    EXPECT_EQ(min, vector.minCoeffOfFinites()) << size;
+    EXPECT_EQ(max, vector.maxCoeffOfFinites()) << size;
+    EXPECT_NEAR(sum, vectorDouble.sumOfFinites(), 1e-5) << size;
+    EXPECT_EQ(min, vectorDouble.minCoeffOfFinites()) << size;
+    EXPECT_EQ(max, vectorDouble.maxCoeffOfFinites()) << size;
+  }
+
+  // Without finite values, the result is the reduction of the non-finite values.
+  Eigen::MatrixXf matrix(Eigen::MatrixXf::Constant(17, 9, INFINITY));
+  EXPECT_EQ(INFINITY, matrix.sumOfFinites());
+  EXPECT_EQ(INFINITY, matrix.minCoeffOfFinites());
+  matrix(3, 4) = NAN;
+  EXPECT_TRUE(std::isnan(matrix.sumOfFinites()));
+  matrix(5, 5) = 2.0;
+  EXPECT_EQ(2.0, matrix.sumOfFinites());
+  EXPECT_EQ(2.0, matrix.minCoeffOfFinites());
+  EXPECT_EQ(2.0, matrix.maxCoeffOfFinites());
+
+  // Finite values summing up to zero.
+  matrix.setConstant(NAN);
+  matrix(0, 0) = 1.0;
+  matrix(9, 7) = -1.0;
+  EXPECT_EQ(0.0, matrix.sumOfFinites());
+  EXPECT_EQ(-1.0, matrix.block(2, 1, 10, 7).sumOfFinites());
+}
+
+TEST(EigenMatrixBaseAddons, integerReductionsOfFinites)
+{
+  Eigen::Matrix<uint8_t, Eigen::Dynamic, Eigen::Dynamic> matrix(300, 200);
+  uint64_t sum = 0;
+  for (int i = 0; i < matrix.size(); ++i) {
+    matrix(i) = (i * 7) % 251;
+    sum += matrix(i);
+  }
+  matrix(123) = 0;
+  matrix(4567) = 255;
+  sum += 0 - (123 * 7) % 251 + 255 - (4567 * 7) % 251;
+  EXPECT_EQ(static_cast<uint8_t>(matrix.size()), matrix.numberOfFinites());
+  EXPECT_EQ(sum, matrix.sumOfFinites());
+  EXPECT_EQ(sum, matrix.block(0, 0, 300, 200).sumOfFinites());
+  EXPECT_EQ(sum, (matrix.array() + 0).sumOfFinites());
+  EXPECT_EQ(sum - matrix.row(0).cast<uint64_t>().sum(), matrix.bottomRows(299).sumOfFinites());
+  EXPECT_EQ(static_cast<uint8_t>(double(sum) / matrix.size()), matrix.meanOfFinites());
+  EXPECT_EQ(0, matrix.minCoeffOfFinites());
+  EXPECT_EQ(255, matrix.maxCoeffOfFinites());
+  EXPECT_EQ(matrix(1, 1), matrix.block(1, 1, 1, 1).meanOfFinites());
+
+  Eigen::Matrix<int16_t, Eigen::Dynamic, 1> vector(Eigen::Matrix<int16_t, Eigen::Dynamic, 1>::Constant(100000, -30000));
+  EXPECT_EQ(-30000, vector.meanOfFinites());
+  EXPECT_EQ(-3000000000, vector.sumOfFinites());
+}
@@ -7,6 +7,7 @@
  */
 
 #include "grid_map/iterators/EllipseIterator.hpp"
+#include "grid_map/iterators/SubmapIterator.hpp"
 #include "grid_map/GridMap.hpp"
 
 // Eigen
@@ -58,3 +59,55 @@ TEST(EllipseIterator, OneCellWideEllipse)
   ++iterator;
   EXPECT_TRUE(iterator.isPastEnd());
 }
+
+TEST(EllipseIterator, Spans)
+{
+  GridMap map({"iterator", "spans"});
+  map.setGeometry(Length(8.0, 5.0), 0.5, Position(0.0, 0.0)); // bufferSize(16, 10)
+  map.move(Position(-1.5, 0.5));
+  map["iterator"].setZero();
+  map["spans"].setZero();
+
+  EllipseIterator iterator(map, Position(-2.0, 0.8), Length(4.0, 2.5), 0.4);
+  std::vector<Span> spans;
+  iterator.getSpans(spans);
+  for (; !iterator.isPastEnd(); ++iterator) {
+    map.at("iterator", *iterator) += 1;
+  }
+  for (const auto& span : spans) {
+    span.segment(map["spans"]).array() += 1;
+  }
+  EXPECT_GT(map["iterator"].cast<int>().sum(), 0);
+  EXPECT_TRUE((map["iterator"].array() == map["spans"].array()).all());
+}
+
+TEST(EllipseIterator, InsideCellsInOrder)
+{
+  GridMap map({"types"});
+  map.setGeometry(Length(8.0, 5.0), 0.5, Position(0.0, 0.0)); // bufferSize(16, 10)
+  map.move(Position(-1.5, 0.5));
+
+  const Position center(-2.0, 0.8);
+  const Length length(4.0, 2.5);
+  const double rotation = 0.4;
+  Eigen::Matrix2d transform;
+  transform << cos(rotation), sin(rotation), sin(rotation), -cos(rotation);
+  std::vector<grid_map::Index> expected;
+  for (SubmapIterator iterator(map, map.getStartIndex(), map.getSize()); !iterator.isPastEnd(); ++iterator) {
+    Position position;
+    map.getPosition(*iterator, position);
+    const double value = ((transform * (position - center)).array().square() / (0.5 * length).square()).sum();
+    if (value <= 1.0) expected.push_back(*iterator);
+  }
+  std::vector<grid_map::Index> cells;
+  for (EllipseIterator iterator(map, center, length, rotation); !iterator.isPastEnd(); ++iterator) {
+    cells.push_back(*iterator);
+  }
+
+  ASSERT_FALSE(expected.empty());
+  ASSERT_EQ(expected.size(), cells.size());
+  for (size_t i = 0; i < cells.size(); ++i) {
+    EXPECT_EQ(expected[i](0), cells[i](0));
+    EXPECT_EQ(expected[i](1), cells[i](1));
+  }
+}
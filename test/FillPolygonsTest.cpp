@@ -0,0 +1,68 @@
+/*
+ * FillPolygonsTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map/operators/FillPolygons.hpp"
+#include "grid_map/iterators/PolygonIterator.hpp"
+#include "grid_map/GridMap.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+// STL
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+using namespace grid_map;
+
+TEST(FillPolygons, MatchesPolygonIterator)
+{
+  GridMap map({"zones", "expected"});
+  map.setGeometry(Length(8.0, 6.0), 0.05, Position(0.0, 0.0));
+  map.move(Position(1.37, -0.52));
+
+  // Random zones, some of them crossing the map border.
+  srand(1);
+  std::vector<Polygon> polygons;
+  std::vector<unsigned char> values;
+  for (int i = 0; i < 200; ++i) {
+    const Position center = map.getPosition() + Position(10.0 * rand() / RAND_MAX - 5.0, 8.0 * rand() / RAND_MAX - 4.0);
+    const double radius = 0.05 + 1.5 * rand() / RAND_MAX;
+    Polygon polygon;
+    const int nVertices = 3 + rand() % 5;
+    for (int k = 0; k < nVertices; ++k) {
+      const double angle = 2.0 * M_PI * k / nVertices + 0.3 * rand() / RAND_MAX;
+      const double r = radius * (k % 2 == 0 ? 1.0 : 0.4);
+      polygon.addVertex(center + r * Vector(std::cos(angle), std::sin(angle)));
+    }
+    polygons.push_back(polygon);
+    values.push_back(rand() % 256);
+  }
+
+  ThreadPool threadPool(4);
+  for (const auto mode : {PolygonFillMode::OVERWRITE, PolygonFillMode::MAXIMUM, PolygonFillMode::MINIMUM}) {
+    map["zones"].setConstant(100);
+    map["expected"].setConstant(100);
+    FillPolygons(mode, 7)("zones", polygons, values, map, threadPool);
+
+    for (size_t i = 0; i < polygons.size(); ++i) {
+      for (PolygonIterator iterator(map, polygons[i]); !iterator.isPastEnd(); ++iterator) {
+        unsigned char& expected = map.at("expected", *iterator);
+        switch (mode) {
+          case PolygonFillMode::OVERWRITE: expected = values[i]; break;
+          case PolygonFillMode::MAXIMUM: expected = std::max(expected, values[i]); break;
+          case PolygonFillMode::MINIMUM: expected = std::min(expected, values[i]); break;
+        }
+      }
+    }
+    EXPECT_TRUE((map["zones"].array() == map["expected"].array()).all());
+    EXPECT_GT((map["zones"].array() != 100).count(), map["zones"].size() / 4);
+  }
+
+  std::vector<unsigned char> tooFewValues(values.begin(), values.end() - 1);
+  EXPECT_THROW(FillPolygons()("zones", polygons, tooFewValues, map, threadPool), std::invalid_argument);
+  EXPECT_THROW(FillPolygons()("none", polygons, 254, map, threadPool), std::out_of_range);
+}
@@ -0,0 +1,132 @@
+/*
+ * FootprintCheckerTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map/operators/FootprintChecker.hpp"
+#include "grid_map/iterators/PolygonIterator.hpp"
+#include "grid_map/GridMap.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+// STL
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+using namespace grid_map;
+
+namespace {
+
+Polygon getFootprint()
+{
+  // Vertices off the grid of the test maps, no cell center lies on an edge.
+  return Polygon({Position(0.451, 0.013), Position(0.307, 0.254), Position(-0.296, 0.308),
+                  Position(-0.353, -0.197), Position(0.248, -0.302)});
+}
+
+unsigned char getExpectedCost(const GridMap& map, const Polygon& footprint, const Position& position,
+                              const double heading, const unsigned char outsideCost)
+{
+  const Eigen::Matrix2d rotation = (Eigen::Matrix2d() << std::cos(heading), -std::sin(heading),
+                                                         std::sin(heading), std::cos(heading)).finished();
+  Polygon polygon;
+  for (const auto& vertex : footprint.getVertices()) polygon.addVertex(position + rotation * vertex);
+  // Iterate a larger map on the same grid to also get the footprint cells outside of the map.
+  GridMap cover;
+  cover.setGeometry(map.getLength() + Length(4.0, 4.0), map.getResolution(), map.getPosition());
+  unsigned char cost = 0;
+  for (PolygonIterator iterator(cover, polygon); !iterator.isPastEnd(); ++iterator) {
+    Position center;
+    cover.getPosition(*iterator, center);
+    cost = std::max(cost, map.isInside(center) ? map.atPosition("costs", center) : outsideCost);
+  }
+  return cost;
+}
+
+} // namespace
+
+TEST(FootprintChecker, MatchesPolygonIterator)
+{
+  GridMap map({"costs"});
+  map.setGeometry(Length(6.0, 5.0), 0.05, Position(0.0, 0.0));
+  for (const bool moved : {false, true}) {
+    if (moved) map.move(Position(-0.73, 1.32));
+    srand(1);
+    for (int i = 0; i < map["costs"].size(); ++i) map["costs"](i) = rand() % 250;
+
+    // Inside, partially outside (robot cell inside and outside) and fully outside of the map.
+    std::vector<Position> positions{Position(0.5, -0.3), Position(-1.4, 1.9), Position(1.1, 0.7)};
+    for (const Vector& offset : {Vector(2.8, 0.3), Vector(-2.9, -2.35), Vector(0.2, 2.45), Vector(3.2, -0.6),
+                                 Vector(-1.3, -2.7), Vector(-3.1, 2.6), Vector(4.0, 1.0), Vector(-0.5, -3.6)}) {
+      positions.push_back(map.getPosition() + offset);
+    }
+    for (const unsigned char outsideCost : {NO_INFORMATION, FREE_SPACE}) {
+      FootprintChecker checker(getFootprint(), 16);
+      checker.setOutsideCost(outsideCost);
+      for (int k = 0; k < 16; ++k) {
+        const double heading = 2.0 * M_PI * k / 16;
+        for (const Position& position : positions) {
+          // Cell centered poses, the checker snaps to these.
+          const Position center = map.getPosition() + map.getResolution()
+              * (((position - map.getPosition()) / map.getResolution()).array().floor() + 0.5).matrix();
+          EXPECT_EQ(getExpectedCost(map, getFootprint(), center, heading, outsideCost),
+                    checker.getCost("costs", center, heading, map)) << position.transpose() << ", " << k;
+        }
+      }
+    }
+  }
+}
+
+TEST(FootprintChecker, CollisionAndOutside)
+{
+  GridMap map({"costs"});
+  map.setGeometry(Length(4.0, 4.0), 0.1, Position(0.0, 0.0));
+  map.move(Position(0.35, -0.42));
+  map["costs"].setConstant(FREE_SPACE);
+  map.atPosition("costs", Position(0.8, 0.5)) = LETHAL_OBSTACLE;
+
+  FootprintChecker checker(getFootprint());
+  EXPECT_EQ(0, checker.getCost("costs", Position(0.0, 0.0), 0.3, map));
+  EXPECT_TRUE(checker.isInCollision("costs", Position(0.4, 0.5), 0.0, map));
+  EXPECT_FALSE(checker.isInCollision("costs", Position(0.4, 0.5), M_PI, map));
+  EXPECT_EQ(checker.getHeadingIndex(0.0), checker.getHeadingIndex(2.0 * M_PI));
+  EXPECT_EQ(checker.getNumberOfHeadings() - 1, checker.getHeadingIndex(-2.0 * M_PI / checker.getNumberOfHeadings()));
+
+  // Partially and fully outside of the map.
+  EXPECT_EQ(NO_INFORMATION, checker.getCost("costs", Position(2.3, 0.0), 0.0, map));
+  EXPECT_EQ(NO_INFORMATION, checker.getCost("costs", Position(10.0, 0.0), 0.0, map));
+  checker.setOutsideCost(FREE_SPACE);
+  EXPECT_EQ(FREE_SPACE, checker.getCost("costs", Position(2.3, 0.0), 0.0, map));
+
+  // The tables follow the resolution of the map.
+  const size_t nCells = checker.getNumberOfCells(0);
+  map.setGeometry(Length(4.0, 4.0), 0.05, Position(0.0, 0.0));
+  map["costs"].setConstant(FREE_SPACE);
+  EXPECT_EQ(0, checker.getCost("costs", Position(0.0, 0.0), 0.0, map));
+  EXPECT_GT(checker.getNumberOfCells(0), 3 * nCells);
+}
+
+TEST(FootprintChecker, Batch)
+{
+  GridMap map({"costs"});
+  map.setGeometry(Length(5.0, 5.0), 0.05, Position(0.0, 0.0));
+  map.move(Position(1.03, 0.24));
+  srand(2);
+  for (int i = 0; i < map["costs"].size(); ++i) map["costs"](i) = rand() % 256;
+
+  Eigen::Matrix3Xd poses(3, 500);
+  for (int i = 0; i < poses.cols(); ++i) {
+    poses.col(i) << -2.0 + 6.0 * rand() / RAND_MAX, -2.5 + 5.5 * rand() / RAND_MAX, 7.0 * rand() / RAND_MAX - 3.5;
+  }
+  FootprintChecker checker(getFootprint());
+  ThreadPool threadPool(4);
+  std::vector<unsigned char> costs;
+  checker.getCosts("costs", poses, map, costs, threadPool);
+  ASSERT_EQ(poses.cols(), costs.size());
+  for (int i = 0; i < poses.cols(); ++i) {
+    EXPECT_EQ(checker.getCost("costs", poses.col(i).head<2>(), poses(2, i), map), costs[i]);
+  }
+}
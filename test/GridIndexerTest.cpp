@@ -0,0 +1,143 @@
+/*
+ * GridIndexerTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map/GridIndexer.hpp"
+
+// Eigen
+#include <Eigen/Core>
+
+// gtest
+#include <gtest/gtest.h>
+
+// STL
+#include <vector>
+
+using namespace std;
+using namespace grid_map;
+
+TEST(GridIndexer, PositionFromIndex)
+{
+  // The center of the top left cell (unwrapped index (0, 0)) is at (0.95, 3.45).
+  const Length mapLength(5.0, 3.0);
+  const Position mapPosition(-1.3, 2.2);
+  const double resolution = 0.5;
+  const Size bufferSize(10, 6);
+
+  struct Case { Index startIndex; Index bufferIndex; Position position; };
+  const std::vector<Case> cases = {
+      {Index(0, 0), Index(0, 0), Position(0.95, 3.45)},
+      {Index(0, 0), Index(9, 5), Position(-3.55, 0.95)},
+      {Index(0, 0), Index(4, 3), Position(-1.05, 1.95)},
+      {Index(3, 5), Index(3, 5), Position(0.95, 3.45)},
+      {Index(3, 5), Index(0, 0), Position(-2.55, 2.95)},
+      {Index(3, 5), Index(2, 4), Position(-3.55, 0.95)},
+      {Index(9, 1), Index(9, 1), Position(0.95, 3.45)},
+      {Index(9, 1), Index(0, 0), Position(0.45, 0.95)},
+      {Index(9, 1), Index(8, 0), Position(-3.55, 0.95)}};
+
+  for (const auto& c : cases) {
+    GridIndexer indexer(mapLength, mapPosition, resolution, bufferSize, c.startIndex);
+    Position position;
+    EXPECT_TRUE(indexer.getPositionFromIndex(position, c.bufferIndex));
+    EXPECT_NEAR(c.position.x(), position.x(), 1e-12) << c.startIndex.transpose() << " " << c.bufferIndex.transpose();
+    EXPECT_NEAR(c.position.y(), position.y(), 1e-12) << c.startIndex.transpose() << " " << c.bufferIndex.transpose();
+  }
+
+  GridIndexer indexer(mapLength, mapPosition, resolution, bufferSize, Index(3, 5));
+  Position position;
+  EXPECT_FALSE(indexer.getPositionFromIndex(position, Index(10, 0)));
+  EXPECT_FALSE(indexer.getPositionFromIndex(position, Index(0, -1)));
+}
+
+TEST(GridIndexer, IndexFromPosition)
+{
+  // The map covers x in [-3.8, 1.2) and y in [0.7, 3.7).
+  const Length mapLength(5.0, 3.0);
+  const Position mapPosition(-1.3, 2.2);
+  const double resolution = 0.5;
+  const Size bufferSize(10, 6);
+
+  struct Case { Index startIndex; Position position; Index bufferIndex; };
+  const std::vector<Case> cases = {
+      {Index(0, 0), Position(0.9, 3.4), Index(0, 0)},
+      {Index(0, 0), Position(-3.5, 1.0), Index(9, 5)},
+      {Index(0, 0), Position(-1.0, 2.0), Index(4, 3)},
+      {Index(3, 5), Position(0.9, 3.4), Index(3, 5)},
+      {Index(3, 5), Position(-3.5, 1.0), Index(2, 4)},
+      {Index(3, 5), Position(-1.0, 2.0), Index(7, 2)},
+      {Index(9, 1), Position(0.9, 3.4), Index(9, 1)},
+      {Index(9, 1), Position(-3.5, 1.0), Index(8, 0)},
+      {Index(9, 1), Position(-1.0, 2.0), Index(3, 4)}};
+
+  for (const auto& c : cases) {
+    GridIndexer indexer(mapLength, mapPosition, resolution, bufferSize, c.startIndex);
+    Index index;
+    EXPECT_TRUE(indexer.isInside(c.position));
+    EXPECT_TRUE(indexer.getIndexFromPosition(index, c.position));
+    EXPECT_EQ(c.bufferIndex(0), index(0)) << c.startIndex.transpose() << " " << c.position.transpose();
+    EXPECT_EQ(c.bufferIndex(1), index(1)) << c.startIndex.transpose() << " " << c.position.transpose();
+  }
+
+  GridIndexer indexer(mapLength, mapPosition, resolution, bufferSize, Index(9, 1));
+  Index index;
+  for (const Position& position : {Position(1.3, 3.0), Position(-3.9, 3.0), Position(0.0, 0.6), Position(0.0, 3.8)}) {
+    EXPECT_FALSE(indexer.isInside(position)) << position.transpose();
+    EXPECT_FALSE(indexer.getIndexFromPosition(index, position)) << position.transpose();
+  }
+}
+
+TEST(GridIndexer, BufferIndex)
+{
+  GridIndexer indexer(Length(4.0, 3.0), Position(0.0, 0.0), 1.0, Size(4, 3), Index(2, 1));
+
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      const Index bufferIndex = indexer.getBufferIndexFromIndex(Index(i, j));
+      EXPECT_EQ((i + 2) % 4, bufferIndex(0));
+      EXPECT_EQ((j + 1) % 3, bufferIndex(1));
+      const Index index = indexer.getIndexFromBufferIndex(bufferIndex);
+      EXPECT_EQ(i, index(0));
+      EXPECT_EQ(j, index(1));
+    }
+  }
+}
+
+TEST(GridIndexer, Batch)
+{
+  const Length mapLength(5.0, 3.0);
+  const Position mapPosition(0.4, -0.7);
+  const double resolution = 0.25;
+  const Size bufferSize(20, 12);
+  GridIndexer indexer(mapLength, mapPosition, resolution, bufferSize, Index(7, 11));
+
+  Eigen::Matrix2Xd positions(2, 5);
+  positions << 0.4, 2.8, -2.0, 10.0, 1.1,
+              -0.7, 0.7, -2.1, 0.0, -0.1;
+
+  Eigen::Array2Xi indices;
+  Eigen::Array<bool, Eigen::Dynamic, 1> isValid;
+  EXPECT_EQ(4u, indexer.getIndicesFromPositions(positions, indices, isValid));
+  EXPECT_FALSE(isValid(3));
+
+  for (int k = 0; k < positions.cols(); ++k) {
+    EXPECT_TRUE(indices(0, k) >= 0 && indices(0, k) < bufferSize(0));
+    EXPECT_TRUE(indices(1, k) >= 0 && indices(1, k) < bufferSize(1));
+    if (!isValid(k)) continue;
+    Index index;
+    EXPECT_TRUE(indexer.getIndexFromPosition(index, positions.col(k)));
+    EXPECT_EQ(index(0), indices(0, k));
+    EXPECT_EQ(index(1), indices(1, k));
+  }
+
+  Eigen::Matrix2Xd centers;
+  indexer.getPositionsFromIndices(indices, centers);
+  for (int k = 0; k < indices.cols(); ++k) {
+    Position center;
+    EXPECT_TRUE(indexer.getPositionFromIndex(center, indices.col(k)));
+    EXPECT_DOUBLE_EQ(center.x(), centers(0, k));
+    EXPECT_DOUBLE_EQ(center.y(), centers(1, k));
+  }
+}
@@ -61,3 +61,21 @@ TEST(GridMapIterator, LinearIndex)
   EXPECT_TRUE(iterator.isPastEnd());
   EXPECT_TRUE((map["layer"].array() == 1.0f).all());
 }
+
+TEST(GridMapIterator, Spans)
+{
+  GridMap map;
+  map.setGeometry(Length(8.1, 5.1), 1.0, Position(0.0, 0.0)); // bufferSize(8, 5)
+  map.add("layer", 0.0);
+  GridMapIterator iterator(map);
+
+  std::vector<Span> spans;
+  iterator.getSpans(spans);
+  ASSERT_EQ(5, spans.size());
+  for (const auto& span : spans) {
+    EXPECT_EQ(0, span.rowStart);
+    EXPECT_EQ(8, span.length);
+    span.segment(map["layer"]).setConstant(1);
+  }
+  EXPECT_TRUE((map["layer"].array() == 1).all());
+}
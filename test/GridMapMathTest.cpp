@@ -323,6 +323,23 @@ TEST(wrapIndexToRange, All)
   EXPECT_EQ(1, index);
 }
 
+TEST(wrapIndexToRange, PowerOfTwo)
+{
+  const int bufferSize = 8;
+  EXPECT_TRUE(isPowerOfTwo(bufferSize));
+  EXPECT_FALSE(isPowerOfTwo(10));
+  EXPECT_EQ(8, getNextPowerOfTwo(5));
+  EXPECT_EQ(8, getNextPowerOfTwo(8));
+  EXPECT_EQ(1, getNextPowerOfTwo(1));
+  EXPECT_EQ(3, getPowerOfTwoExponent(8));
+
+  for (int i = -35; i < 35; ++i) {
+    int index = i;
+    wrapIndexToRange(index, bufferSize);
+    EXPECT_EQ(((i % bufferSize) + bufferSize) % bufferSize, index);
+  }
+}
+
 TEST(boundPositionToRange, Simple)
 {
   double epsilon = 11.0 * numeric_limits<double>::epsilon();
@@ -7,6 +7,8 @@
  */
 
 #include "grid_map/GridMap.hpp"
+#include "grid_map/GridMapMath.hpp"
+#include "grid_map/iterators/GridMapIterator.hpp"
 
 // gtest
 #include <gtest/gtest.h>
@@ -84,6 +86,35 @@ TEST(GridMap, Move)
   EXPECT_EQ(2, regions[1].getSize()[1]);
 }
 
+TEST(GridMap, PowerOfTwoBufferMode)
+{
+  GridMap map({"layer"});
+  map.setBufferMode(BufferMode::POWER_OF_TWO);
+  map.setGeometry(Length(6.0, 3.0), 1.0, Position(0.0, 0.0)); // rounded up from (6, 3)
+  EXPECT_EQ(8, map.getSize()(0));
+  EXPECT_EQ(4, map.getSize()(1));
+  EXPECT_DOUBLE_EQ(8.0, map.getLength().x());
+  EXPECT_DOUBLE_EQ(4.0, map.getLength().y());
+
+  map.move(Position(-3.0, 5.0));
+  EXPECT_EQ(3, map.getStartIndex()(0));
+  EXPECT_EQ(3, map.getStartIndex()(1));
+
+  // The conversions have to agree with the generic (modulo) implementations.
+  for (GridMapIterator iterator(map); !iterator.isPastEnd(); ++iterator) {
+    const Index index(*iterator);
+    const Index expected = getIndexFromLinearIndex(iterator.getLinearIndex(), map.getSize());
+    EXPECT_EQ(expected(0), index(0));
+    EXPECT_EQ(expected(1), index(1));
+    Position position;
+    Index indexFromPosition;
+    EXPECT_TRUE(map.getPosition(index, position));
+    EXPECT_TRUE(map.getIndex(position, indexFromPosition));
+    EXPECT_EQ(index(0), indexFromPosition(0));
+    EXPECT_EQ(index(1), indexFromPosition(1));
+  }
+}
+
 TEST(AddDataFrom, ExtendMapAligned)
 {
   GridMap map1, map2;
@@ -221,3 +252,57 @@ TEST(ValueAtPosition, LinearInterpolated)
   value = map.atPosition("types", Position(0.69,0.38), InterpolationMethods::INTER_LINEAR);
   EXPECT_NEAR(2.1963200, value, 0.0000001);
 }
+
+TEST(ValueAtPosition, BatchNearestNeighbor)
+{
+  GridMap map( { "types" });
+  map.setGeometry(Length(8.0, 5.0), 1.0, Position(0.0, 0.0)); // bufferSize(8, 5)
+  map.move(Position(-3.0, -2.0));
+  for (GridMapIterator iterator(map); !iterator.isPastEnd(); ++iterator) {
+    map.at("types", *iterator) = iterator.getLinearIndex();
+  }
+
+  Eigen::Matrix2Xd positions(2, 5);
+  positions << 0.9, -0.3, -6.9, -2.5, 100.0,
+             -0.4,  0.0, -4.4, -2.1,   0.0;
+  Eigen::Matrix<Matrix::Scalar, Eigen::Dynamic, 1> values;
+  Eigen::Array<bool, Eigen::Dynamic, 1> isValid;
+
+  EXPECT_EQ(4, map.atPositions("types", positions, values, isValid));
+  ASSERT_EQ(5, values.size());
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_TRUE(isValid(i));
+    EXPECT_EQ(map.atPosition("types", positions.col(i)), values(i));
+  }
+  EXPECT_FALSE(isValid(4));
+}
+
+TEST(ValueAtPosition, BatchLinearInterpolated)
+{
+  GridMap map( { "types" });
+  map.setGeometry(Length(3.0, 3.0), 1.0, Position(0.0, 0.0));
+
+  map.at("types", Index(0,0)) = 10;
+  map.at("types", Index(0,1)) = 30;
+  map.at("types", Index(0,2)) = 20;
+  map.at("types", Index(1,0)) = 20;
+  map.at("types", Index(1,1)) = 10;
+  map.at("types", Index(1,2)) = 20;
+  map.at("types", Index(2,0)) = 10;
+  map.at("types", Index(2,1)) = 20;
+  map.at("types", Index(2,2)) = 20;
+
+  Eigen::Matrix2Xd positions(2, 3);
+  positions << -0.5, -0.5, 0.25,
+               -1.2,  0.0, 0.25;
+  Eigen::Matrix<Matrix::Scalar, Eigen::Dynamic, 1> values;
+  Eigen::Array<bool, Eigen::Dynamic, 1> isValid;
+
+  EXPECT_EQ(3, map.atPositions("types", positions, values, isValid, InterpolationMethods::INTER_LINEAR));
+  // Close to the border -> reverting to INTER_NEAREST.
+  EXPECT_EQ(20, values(0));
+  // In between 10 and 20 field.
+  EXPECT_EQ(15, values(1));
+  // Quarter of a cell towards the upper left neighbors.
+  EXPECT_EQ(15, values(2));
+}
@@ -0,0 +1,93 @@
+/*
+ * LayerAccessorTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map/LayerAccessor.hpp"
+#include "grid_map/GridMap.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+using namespace std;
+using namespace grid_map;
+
+namespace {
+
+GridMap createMap()
+{
+  GridMap map({"layer"});
+  map.setGeometry(Length(4.0, 3.0), 1.0, Position(0.0, 0.0)); // bufferSize(4, 3)
+  map.add("layer", 0);
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      map.at("layer", Index(i, j)) = 10 * i + j;
+    }
+  }
+  return map;
+}
+
+} // namespace
+
+TEST(LayerAccessor, Unchecked)
+{
+  GridMap map = createMap();
+  LayerAccessor<bounds::Unchecked> accessor(map, "layer");
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      EXPECT_EQ(map.at("layer", Index(i, j)), *accessor.find(Index(i, j)));
+    }
+  }
+  EXPECT_EQ(map.atPosition("layer", Position(0.5, -0.5)), *accessor.findAtPosition(Position(0.5, -0.5)));
+
+  LayerAccessor<bounds::Unchecked, DataType> writer(map, "layer");
+  *writer.find(Index(2, 1)) = 99;
+  EXPECT_EQ(99, map.at("layer", Index(2, 1)));
+}
+
+TEST(LayerAccessor, Checked)
+{
+  GridMap map = createMap();
+  LayerAccessor<bounds::Checked> accessor(map, "layer");
+  DataType value = 0;
+  EXPECT_TRUE(accessor.get(Index(3, 2), value));
+  EXPECT_EQ(32, value);
+  EXPECT_FALSE(accessor.get(Index(4, 0), value));
+  EXPECT_FALSE(accessor.get(Index(0, -1), value));
+  EXPECT_EQ(nullptr, accessor.find(Index(-1, 0)));
+
+  EXPECT_TRUE(accessor.getAtPosition(Position(-1.5, 1.5), value));
+  EXPECT_EQ(map.atPosition("layer", Position(-1.5, 1.5)), value);
+  EXPECT_FALSE(accessor.getAtPosition(Position(2.5, 0.0), value));
+  EXPECT_EQ(255, accessor.valueAtPositionOr(Position(0.0, -1.6), 255));
+  EXPECT_THROW(LayerAccessor<bounds::Checked>(map, "unknown"), std::out_of_range);
+}
+
+TEST(LayerAccessor, Clamped)
+{
+  GridMap map = createMap();
+  LayerAccessor<bounds::Clamped> accessor(map, "layer");
+  EXPECT_EQ(map.at("layer", Index(3, 0)), accessor.valueOr(Index(7, -2), 0));
+  // Beyond the top left corner of the map (positive x and y).
+  EXPECT_EQ(map.at("layer", Index(0, 0)), accessor.valueAtPositionOr(Position(10.0, 10.0), 255));
+  EXPECT_EQ(map.at("layer", Index(3, 1)), accessor.valueAtPositionOr(Position(-10.0, 0.0), 255));
+}
+
+TEST(LayerAccessor, Wrapped)
+{
+  GridMap map = createMap();
+  map.move(Position(-1.0, 1.0)); // Start index (1, 2).
+  LayerAccessor<bounds::Wrapped> accessor(map, "layer");
+  EXPECT_EQ(map.at("layer", Index(1, 2)), accessor.valueOr(Index(5, -1), 0));
+
+  // Inside the map, wrapping gives the same cells as the regular lookup.
+  for (double x = -2.9; x < 1.0; x += 0.5) {
+    for (double y = -0.4; y < 2.5; y += 0.5) {
+      EXPECT_EQ(map.atPosition("layer", Position(x, y)), accessor.valueAtPositionOr(Position(x, y), 255));
+    }
+  }
+  // One map length further wraps back to the same cell.
+  EXPECT_EQ(map.atPosition("layer", Position(-0.5, 0.5)), accessor.valueAtPositionOr(Position(-4.5, 0.5), 255));
+  EXPECT_EQ(map.atPosition("layer", Position(-0.5, 0.5)), accessor.valueAtPositionOr(Position(-0.5, 3.5), 255));
+}
@@ -0,0 +1,135 @@
+/*
+ * LayerImageRendererTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map/visualization/LayerImageRenderer.hpp"
+#include "grid_map/GridMap.hpp"
+#include "grid_map/GridMapMath.hpp"
+#include "grid_map/operators/Inflation.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+// STL
+#include <cstdlib>
+#include <vector>
+
+using namespace grid_map;
+
+namespace {
+
+//! Padded image, as QImage lines are aligned.
+struct Image
+{
+  Image(const Size& size)
+      : bytesPerLine((size(1) + 3) * sizeof(uint32_t)),
+        pixels(size(0) * (size(1) + 3), 0)
+  {
+  }
+
+  uint32_t pixel(const int x, const int y) const
+  {
+    return pixels[y * (bytesPerLine / sizeof(uint32_t)) + x];
+  }
+
+  size_t bytesPerLine;
+  std::vector<uint32_t> pixels;
+};
+
+void expectMatches(const GridMap& map, const LayerImageRenderer& renderer, const Image& image)
+{
+  for (int y = 0; y < map.getSize()(0); ++y) {
+    for (int x = 0; x < map.getSize()(1); ++x) {
+      const Index bufferIndex = getBufferIndexFromIndex(Index(y, x), map.getSize(), map.getStartIndex());
+      ASSERT_EQ(renderer.getColorTable()[map["layer"](bufferIndex(0), bufferIndex(1))], image.pixel(x, y)) << x << " " << y;
+    }
+  }
+}
+
+} // namespace
+
+TEST(LayerImageRenderer, WrappedBuffer)
+{
+  GridMap map({"layer"});
+  map.setGeometry(Length(9.0, 7.0), 0.05, Position(0.0, 0.0));
+  map.move(Position(1.37, -2.21));
+  srand(1);
+  for (int i = 0; i < map["layer"].size(); ++i) map["layer"](i) = rand() % 256;
+
+  const LayerImageRenderer renderer;
+  Image image(map.getSize());
+  renderer.render(map["layer"], map.getStartIndex(), image.pixels.data(), image.bytesPerLine);
+  expectMatches(map, renderer, image);
+  // The padding is not touched.
+  EXPECT_EQ(0u, image.pixel(map.getSize()(1), 0));
+}
+
+TEST(LayerImageRenderer, DirtyRegions)
+{
+  GridMap map({"layer"});
+  map.setGeometry(Length(9.0, 7.0), 0.05, Position(0.0, 0.0));
+  srand(2);
+  for (int i = 0; i < map["layer"].size(); ++i) map["layer"](i) = rand() % 256;
+
+  const LayerImageRenderer renderer;
+  Image image(map.getSize());
+
+  // The regions of a move, rendered after the cells kept by the move.
+  for (const Position& position : {Position(1.37, -2.21), Position(-0.5, 0.8), Position(-0.6, 0.7)}) {
+    std::vector<BufferRegion> newRegions;
+    map.move(position, newRegions);
+    renderer.render(map["layer"], map.getStartIndex(), image.pixels.data(), image.bytesPerLine);
+    for (const auto& region : newRegions) {
+      map["layer"].block(region.getStartIndex()(0), region.getStartIndex()(1), region.getSize()(0),
+                         region.getSize()(1)).setConstant(rand() % 256);
+    }
+    for (const auto& region : newRegions) {
+      renderer.render(map["layer"], map.getStartIndex(), region, image.pixels.data(), image.bytesPerLine);
+    }
+    expectMatches(map, renderer, image);
+  }
+
+  // A dirty region crossing the wrap of the buffer.
+  Index start;
+  ASSERT_TRUE(map.getIndex(Position(0.0, 0.0), start));
+  const BufferRegion region(start, Size(80, 60), BufferRegion::Quadrant::Undefined);
+  for (int i = 0; i < region.getSize()(0); ++i) {
+    for (int j = 0; j < region.getSize()(1); ++j) {
+      const Index index = getBufferIndexFromIndex(Index(i, j), map.getSize(), start);
+      map["layer"](index(0), index(1)) = LETHAL_OBSTACLE;
+    }
+  }
+  renderer.render(map["layer"], map.getStartIndex(), region, image.pixels.data(), image.bytesPerLine);
+  expectMatches(map, renderer, image);
+}
+
+TEST(LayerImageRenderer, Tiles)
+{
+  GridMap map({"layer"});
+  map.setGeometry(Length(9.0, 7.0), 0.05, Position(0.0, 0.0));
+  map.move(Position(-2.03, 0.61));
+  srand(3);
+  for (int i = 0; i < map["layer"].size(); ++i) map["layer"](i) = rand() % 256;
+
+  const LayerImageRenderer renderer;
+  Image image(map.getSize());
+  renderer.render(map["layer"], map.getStartIndex(), image.pixels.data(), image.bytesPerLine);
+
+  // Tiles over the whole layer, the last ones clipped.
+  const int tileSize = 64;
+  for (int row = 0; row < map.getSize()(0); row += tileSize) {
+    for (int column = 0; column < map.getSize()(1); column += tileSize) {
+      const Size size = Size(tileSize, tileSize).min(map.getSize() - Index(row, column));
+      Image tile(size);
+      renderer.renderTile(map["layer"], map.getStartIndex(), Index(row, column), Size(tileSize, tileSize),
+                          tile.pixels.data(), tile.bytesPerLine);
+      for (int y = 0; y < size(0); ++y) {
+        for (int x = 0; x < size(1); ++x) {
+          ASSERT_EQ(image.pixel(column + x, row + y), tile.pixel(x, y)) << row << " " << column;
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,122 @@
+/*
+ * LayerPyramidTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map/visualization/LayerPyramid.hpp"
+#include "grid_map/GridMap.hpp"
+#include "grid_map/operators/Inflation.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+// STL
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+using namespace grid_map;
+
+namespace {
+
+//! Compares the levels with max-pooling the layer in map order.
+void expectPooled(const Matrix& data, const Index& bufferStartIndex, const LayerPyramid& pyramid)
+{
+  Matrix unwrapped(data.rows(), data.cols());
+  for (int j = 0; j < data.cols(); ++j) {
+    for (int i = 0; i < data.rows(); ++i) {
+      unwrapped(i, j) = data((i + bufferStartIndex(0)) % data.rows(), (j + bufferStartIndex(1)) % data.cols());
+    }
+  }
+  ASSERT_TRUE(data == pyramid.getLevel(0));
+  EXPECT_TRUE((pyramid.getBufferStartIndex(0) == bufferStartIndex).all());
+  for (size_t level = 1; level < pyramid.getNumberOfLevels(); ++level) {
+    const Matrix& cells = pyramid.getLevel(level);
+    const int step = 1 << level;
+    EXPECT_TRUE((pyramid.getBufferStartIndex(level) == Index::Zero()).all());
+    ASSERT_EQ((data.rows() + step - 1) / step, cells.rows());
+    ASSERT_EQ((data.cols() + step - 1) / step, cells.cols());
+    for (int j = 0; j < cells.cols(); ++j) {
+      for (int i = 0; i < cells.rows(); ++i) {
+        const int rows = std::min(step, int(data.rows()) - i * step);
+        const int cols = std::min(step, int(data.cols()) - j * step);
+        ASSERT_EQ(unwrapped.block(i * step, j * step, rows, cols).maxCoeff(), cells(i, j))
+            << level << " " << i << " " << j;
+      }
+    }
+  }
+}
+
+} // namespace
+
+TEST(LayerPyramid, Levels)
+{
+  GridMap map({"layer"});
+  map.setGeometry(Length(9.05, 7.05), 0.05, Position(0.0, 0.0)); // 181 x 141 cells
+  map.move(Position(1.32, -2.26));
+  ASSERT_TRUE((map.getStartIndex() == Index(155, 45)).all());
+  srand(1);
+  for (int i = 0; i < map["layer"].size(); ++i) map["layer"](i) = rand() % 200;
+
+  LayerPyramid pyramid(20);
+  EXPECT_TRUE(pyramid.isEmpty());
+  pyramid.setLayer(map["layer"], map.getStartIndex());
+  EXPECT_FALSE(pyramid.isEmpty());
+  // 181, 91, 46, 23, 12
+  ASSERT_EQ(5u, pyramid.getNumberOfLevels());
+  EXPECT_TRUE((pyramid.getSize(4) == Size(12, 9)).all());
+  expectPooled(map["layer"], map.getStartIndex(), pyramid);
+
+  EXPECT_EQ(0u, pyramid.getLevelForScale(2.0));
+  EXPECT_EQ(0u, pyramid.getLevelForScale(1.0));
+  EXPECT_EQ(1u, pyramid.getLevelForScale(0.5));
+  EXPECT_EQ(2u, pyramid.getLevelForScale(0.4));
+  EXPECT_EQ(4u, pyramid.getLevelForScale(0.001));
+
+  pyramid.clear();
+  EXPECT_TRUE(pyramid.isEmpty());
+}
+
+TEST(LayerPyramid, Update)
+{
+  GridMap map({"layer"});
+  map.setGeometry(Length(9.05, 7.05), 0.05, Position(0.0, 0.0)); // 181 x 141 cells
+  srand(2);
+  for (int i = 0; i < map["layer"].size(); ++i) map["layer"](i) = rand() % 200;
+
+  LayerPyramid pyramid(16);
+  pyramid.setLayer(map["layer"], map.getStartIndex());
+
+  for (const Position& position : {Position(1.37, -2.21), Position(-0.5, 0.8), Position(-0.65, 0.75)}) {
+    std::vector<BufferRegion> newRegions;
+    map.move(position, newRegions);
+    for (const auto& region : newRegions) {
+      map["layer"].block(region.getStartIndex()(0), region.getStartIndex()(1), region.getSize()(0),
+                         region.getSize()(1)).setConstant(rand() % 256);
+      pyramid.update(map["layer"], map.getStartIndex(), region);
+    }
+    expectPooled(map["layer"], map.getStartIndex(), pyramid);
+  }
+
+  // A single lethal cell shows up at all levels.
+  map["layer"](101, 37) = LETHAL_OBSTACLE;
+  pyramid.update(map["layer"], map.getStartIndex(), BufferRegion(Index(101, 37), Size(1, 1), BufferRegion::Quadrant::Undefined));
+  expectPooled(map["layer"], map.getStartIndex(), pyramid);
+  EXPECT_EQ(LETHAL_OBSTACLE, pyramid.getLevel(pyramid.getNumberOfLevels() - 1).maxCoeff());
+
+  // A region across the first row and column of the map, without a move.
+  const Index start = map.getStartIndex();
+  ASSERT_TRUE((start == Index(13, 126)).all());
+  const BufferRegion region(start - 10, Size(20, 20), BufferRegion::Quadrant::Undefined);
+  map["layer"].block(start(0) - 10, start(1) - 10, 20, 20).setConstant(LETHAL_OBSTACLE - 1);
+  pyramid.update(map["layer"], start, region);
+  expectPooled(map["layer"], start, pyramid);
+
+  // A different size rebuilds.
+  GridMap other({"layer"});
+  other.setGeometry(Length(3.0, 2.0), 0.05, Position(0.0, 0.0));
+  other["layer"].setConstant(FREE_SPACE);
+  pyramid.update(other["layer"], other.getStartIndex(), BufferRegion(Index(0, 0), Size(1, 1), BufferRegion::Quadrant::Undefined));
+  expectPooled(other["layer"], other.getStartIndex(), pyramid);
+}
@@ -0,0 +1,115 @@
+/*
+ * MarkAndClearTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map/operators/MarkAndClear.hpp"
+#include "grid_map/iterators/LineIterator.hpp"
+#include "grid_map/iterators/SubmapIterator.hpp"
+#include "grid_map/GridMap.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+// STL
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+using namespace grid_map;
+
+namespace {
+
+std::vector<Position> getScan(const Position& origin, const int nRays, const double minRange, const double maxRange)
+{
+  srand(1);
+  std::vector<Position> endpoints;
+  for (int k = 0; k < nRays; ++k) {
+    const double angle = 2.0 * M_PI * k / nRays;
+    const double range = minRange + (maxRange - minRange) * rand() / RAND_MAX;
+    endpoints.push_back(origin + range * Vector(std::cos(angle), std::sin(angle)));
+  }
+  return endpoints;
+}
+
+} // namespace
+
+TEST(MarkAndClear, MatchesLineIterator)
+{
+  GridMap map({"obstacles"});
+  map.setGeometry(Length(8.0, 5.0), 0.1, Position(0.0, 0.0));
+  map.move(Position(-1.23, 0.57));
+  map["obstacles"].setConstant(NO_INFORMATION);
+  GridMap expected = map;
+
+  const Position origin(-1.0, 0.4);
+  const std::vector<Position> endpoints = getScan(origin, 5000, 0.5, 2.0);
+  for (const auto& endpoint : endpoints) {
+    LineIterator iterator(expected, origin, endpoint);
+    grid_map::Index index = *iterator;
+    for (++iterator; !iterator.isPastEnd(); ++iterator) {
+      expected.at("obstacles", index) = FREE_SPACE;
+      index = *iterator;
+    }
+  }
+  for (const auto& endpoint : endpoints) expected.atPosition("obstacles", endpoint) = LETHAL_OBSTACLE;
+
+  for (const unsigned int nThreads : {1u, 4u}) {
+    GridMap result = map;
+    MarkAndClear markAndClear;
+    markAndClear.setNumberOfThreads(nThreads);
+    EXPECT_TRUE(markAndClear("obstacles", origin, endpoints, result));
+    EXPECT_TRUE((result["obstacles"].array() == expected["obstacles"].array()).all());
+
+    // All updated cells are in the dirty region.
+    grid_map::Index startIndex;
+    Size size;
+    markAndClear.getDirtyRegion(startIndex, size);
+    int nUpdated = 0;
+    for (SubmapIterator iterator(result, startIndex, size); !iterator.isPastEnd(); ++iterator) {
+      if (result.at("obstacles", *iterator) != NO_INFORMATION) ++nUpdated;
+    }
+    EXPECT_EQ((result["obstacles"].array() != NO_INFORMATION).count(), nUpdated);
+    EXPECT_LT(size.prod(), map.getSize().prod());
+  }
+}
+
+TEST(MarkAndClear, RangesAndUnknownSpace)
+{
+  GridMap map({"obstacles"});
+  map.setGeometry(Length(8.0, 5.0), 0.1, Position(0.0, 0.0));
+  map["obstacles"].setConstant(NO_INFORMATION);
+  map.atPosition("obstacles", Position(0.55, 0.05)) = 100;
+  const Position origin(0.05, 0.05);
+  const std::vector<Position> endpoints = {Position(1.05, 0.05), Position(0.05, 0.85)};
+
+  // Only clear up to 0.6 m, only mark up to 0.9 m.
+  MarkAndClear markAndClear(0.9, 0.6, false);
+  markAndClear("obstacles", origin, endpoints, map);
+  EXPECT_EQ(FREE_SPACE, map.atPosition("obstacles", Position(0.55, 0.05)));
+  EXPECT_EQ(NO_INFORMATION, map.atPosition("obstacles", Position(0.45, 0.05))); // Unknown is not cleared.
+  EXPECT_EQ(NO_INFORMATION, map.atPosition("obstacles", Position(0.85, 0.05)));
+  EXPECT_EQ(NO_INFORMATION, map.atPosition("obstacles", Position(1.05, 0.05))); // Out of obstacle range.
+  EXPECT_EQ(LETHAL_OBSTACLE, map.atPosition("obstacles", Position(0.05, 0.85)));
+
+  MarkAndClear clearUnknown(0.9, 0.6, true);
+  clearUnknown("obstacles", origin, endpoints, map);
+  EXPECT_EQ(FREE_SPACE, map.atPosition("obstacles", Position(0.45, 0.05)));
+  EXPECT_EQ(FREE_SPACE, map.atPosition("obstacles", Position(0.05, 0.45)));
+  EXPECT_EQ(FREE_SPACE, map.atPosition("obstacles", Position(0.65, 0.05))); // Last cell of a range limited ray.
+  EXPECT_EQ(NO_INFORMATION, map.atPosition("obstacles", Position(0.75, 0.05)));
+  EXPECT_EQ(LETHAL_OBSTACLE, map.atPosition("obstacles", Position(0.05, 0.85)));
+}
+
+TEST(MarkAndClear, NoEndpoints)
+{
+  GridMap map({"obstacles"});
+  map.setGeometry(Length(2.0, 2.0), 0.1, Position(0.0, 0.0));
+  MarkAndClear markAndClear;
+  EXPECT_FALSE(markAndClear("obstacles", Position(0.0, 0.0), std::vector<Position>(), map));
+  grid_map::Index startIndex;
+  Size size;
+  markAndClear.getDirtyRegion(startIndex, size);
+  EXPECT_EQ(0, size.prod());
+}
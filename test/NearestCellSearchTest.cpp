@@ -0,0 +1,60 @@
+/*
+ * NearestCellSearchTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map/NearestCellSearch.hpp"
+#include "grid_map/iterators/GridMapIterator.hpp"
+#include "grid_map/GridMap.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+// STL
+#include <cstdlib>
+#include <limits>
+
+using namespace grid_map;
+
+TEST(NearestCellSearch, MatchesBruteForce)
+{
+  GridMap map({"costs"});
+  map.setGeometry(Length(8.0, 5.0), 0.1, Position(0.0, 0.0));
+  map.move(Position(-1.23, 0.57));
+  srand(1);
+  map["costs"] = Matrix::NullaryExpr(map.getSize()(0), map.getSize()(1), []() { return rand() % 50 == 0 ? 0 : 254; });
+  auto isFree = [](const DataType value) { return value == 0; };
+
+  const Position positions[] = {Position(-1.0, 0.5), Position(-3.04, 2.1), Position(1.5, -1.9), Position(4.0, 0.0)};
+  for (const auto& position : positions) {
+    for (const double maxRadius : {0.05, 0.3, 1.0, 10.0}) {
+      double bestDistance = std::numeric_limits<double>::infinity();
+      for (GridMapIterator iterator(map); !iterator.isPastEnd(); ++iterator) {
+        if (!isFree(map.at("costs", *iterator))) continue;
+        Position cellPosition;
+        map.getPosition(*iterator, cellPosition);
+        const double distance = (cellPosition - position).norm();
+        if (distance <= maxRadius) bestDistance = std::min(bestDistance, distance);
+      }
+
+      grid_map::Index index;
+      const bool isFound = findNearest(map, "costs", position, isFree, maxRadius, index);
+      ASSERT_EQ(std::isfinite(bestDistance), isFound);
+      if (!isFound) continue;
+      EXPECT_TRUE(isFree(map.at("costs", index)));
+      Position cellPosition;
+      map.getPosition(index, cellPosition);
+      EXPECT_NEAR(bestDistance, (cellPosition - position).norm(), 1e-12);
+    }
+  }
+}
+
+TEST(NearestCellSearch, NoMatch)
+{
+  GridMap map({"costs"});
+  map.setGeometry(Length(2.0, 2.0), 0.1, Position(0.0, 0.0));
+  map["costs"].setConstant(254);
+  grid_map::Index index;
+  EXPECT_FALSE(findNearest(map, "costs", Position(0.0, 0.0), [](const DataType value) { return value == 0; }, 5.0, index));
+}
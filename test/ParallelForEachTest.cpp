@@ -0,0 +1,124 @@
+/*
+ * ParallelForEachTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map/ParallelForEach.hpp"
+#include "grid_map/Parallel.hpp"
+#include "grid_map/ThreadPool.hpp"
+#include "grid_map/GridMap.hpp"
+#include "grid_map/iterators/CircleIterator.hpp"
+#include "grid_map/iterators/GridMapIterator.hpp"
+#include "grid_map/operators/Inflation.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+// STL
+#include <atomic>
+#include <vector>
+
+using namespace grid_map;
+
+TEST(ThreadPool, RunsEachTaskOnce)
+{
+  ThreadPool threadPool(4);
+  EXPECT_EQ(4, threadPool.getNumberOfThreads());
+  for (const size_t nTasks : {0, 1, 3, 1000}) {
+    std::vector<std::atomic<int>> counts(nTasks);
+    for (auto& count : counts) count = 0;
+    threadPool.run(nTasks, [&](const size_t task, const unsigned int thread) {
+      EXPECT_LT(thread, 4u);
+      ++counts[task];
+    });
+    for (const auto& count : counts) EXPECT_EQ(1, count);
+  }
+}
+
+TEST(ThreadPool, NestedRun)
+{
+  ThreadPool threadPool(3);
+  std::atomic<int> count(0);
+  threadPool.run(10, [&](const size_t, const unsigned int) {
+    threadPool.run(10, [&](const size_t, const unsigned int thread) {
+      EXPECT_EQ(0u, thread);
+      ++count;
+    });
+  });
+  EXPECT_EQ(100, count);
+}
+
+TEST(ParallelFor, NestedInGlobalPool)
+{
+  std::vector<std::atomic<int>> counts(100 * 1000);
+  for (auto& count : counts) count = 0;
+  ThreadPool::getGlobalPool().run(100, [&](const size_t task, const unsigned int) {
+    parallelFor(0, 1000, 0, [&](const size_t i) { ++counts[task * 1000 + i]; }, 16);
+  });
+  for (const auto& count : counts) EXPECT_EQ(1, count);
+}
+
+TEST(ParallelForEach, SpanChunks)
+{
+  const std::vector<Span> spans{Span(0, 3, 10), Span(1, 0, 0), Span(2, 5, 25), Span(4, 0, 3)};
+  std::vector<Span> pieces;
+  std::vector<size_t> chunkBegins;
+  getSpanChunks(spans, 8, pieces, chunkBegins);
+  ASSERT_EQ(6u, chunkBegins.size()); // 38 cells in 5 chunks.
+  EXPECT_EQ(pieces.size(), chunkBegins.back());
+  for (size_t chunk = 0; chunk + 1 < chunkBegins.size(); ++chunk) {
+    int nCells = 0;
+    for (size_t i = chunkBegins[chunk]; i < chunkBegins[chunk + 1]; ++i) nCells += pieces[i].length;
+    EXPECT_EQ(chunk + 2 < chunkBegins.size() ? 8 : 6, nCells);
+  }
+  // Pieces cover the spans in order.
+  std::vector<Index> cells, pieceCells;
+  for (const auto& span : spans) for (int i = 0; i < span.length; ++i) cells.push_back(Index(span.rowStart + i, span.column));
+  for (const auto& span : pieces) for (int i = 0; i < span.length; ++i) pieceCells.push_back(Index(span.rowStart + i, span.column));
+  ASSERT_EQ(cells.size(), pieceCells.size());
+  for (size_t i = 0; i < cells.size(); ++i) EXPECT_TRUE((cells[i] == pieceCells[i]).all());
+}
+
+TEST(ParallelForEach, CircleOnWrappedMap)
+{
+  GridMap map({"layer"});
+  map.setGeometry(Length(8.0, 5.0), 0.1, Position(0.0, 0.0));
+  map.move(Position(-1.23, 0.57));
+  map["layer"].setZero();
+  CircleIterator circleIterator(map, Position(-1.0, 1.0), 1.5);
+  std::vector<Span> spans;
+  circleIterator.getSpans(spans);
+
+  ThreadPool threadPool(4);
+  Matrix& data = map["layer"];
+  parallelForEachCell(spans, [&data](const Index& index) { data(index(0), index(1)) += 1; }, threadPool, 64);
+
+  int nCells = 0;
+  for (; !circleIterator.isPastEnd(); ++circleIterator) {
+    EXPECT_EQ(1, map.at("layer", *circleIterator));
+    ++nCells;
+  }
+  EXPECT_EQ(nCells, (data.array() != 0).count());
+
+  const int sum = parallelReduceCells(spans, 0, [&data](const Index& index, int& result) {
+    result += data(index(0), index(1));
+  }, [](const int a, const int b) { return a + b; }, threadPool, 64);
+  EXPECT_EQ(nCells, sum);
+}
+
+TEST(ParallelForEach, Deflate)
+{
+  GridMap map({"costs"});
+  map.setGeometry(Length(20.0, 20.0), 0.05, Position(0.0, 0.0));
+  map["costs"].setRandom();
+  const Matrix costs = map["costs"];
+  Deflate deflate;
+  deflate("costs", "deflated", map);
+  deflate("costs", "costs", map);
+  for (int i = 0; i < costs.size(); ++i) {
+    const DataType expected = costs(i) >= LETHAL_OBSTACLE ? costs(i) : FREE_SPACE;
+    ASSERT_EQ(expected, map["deflated"](i));
+    ASSERT_EQ(expected, map["costs"](i));
+  }
+}
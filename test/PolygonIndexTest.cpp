@@ -0,0 +1,128 @@
+/*
+ * PolygonIndexTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map/PolygonIndex.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+// STL
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+using namespace grid_map;
+
+namespace {
+
+double getRandom(const double min, const double max)
+{
+  return min + (max - min) * rand() / RAND_MAX;
+}
+
+std::vector<Polygon> getRandomPolygons(const int nPolygons)
+{
+  std::vector<Polygon> polygons;
+  for (int i = 0; i < nPolygons; ++i) {
+    const Position center(getRandom(-10.0, 10.0), getRandom(-10.0, 10.0));
+    // Mostly small zones, some of them large enough not to be bucketed.
+    const double radius = i % 50 == 0 ? getRandom(3.0, 8.0) : getRandom(0.05, 1.0);
+    Polygon polygon;
+    const int nVertices = 3 + rand() % 6;
+    for (int k = 0; k < nVertices; ++k) {
+      const double angle = 2.0 * M_PI * k / nVertices;
+      const double r = radius * (k % 2 == 0 ? 1.0 : getRandom(0.3, 1.0));
+      polygon.addVertex(center + r * Vector(std::cos(angle), std::sin(angle)));
+    }
+    polygons.push_back(polygon);
+  }
+  return polygons;
+}
+
+std::vector<PolygonIndex::Id> getContaining(const PolygonIndex& index, const Position& point)
+{
+  std::vector<PolygonIndex::Id> ids;
+  for (PolygonIndex::Id id = 0; id < 1000; ++id) {
+    if (index.exists(id) && index.getPolygon(id).isInside(point)) ids.push_back(id);
+  }
+  return ids;
+}
+
+} // namespace
+
+TEST(PolygonIndex, PointQueries)
+{
+  srand(1);
+  PolygonIndex index(0.5);
+  std::vector<PolygonIndex::Id> ids;
+  index.insert(getRandomPolygons(500), &ids);
+  ASSERT_EQ(500u, index.size());
+  ASSERT_EQ(500u, ids.size());
+
+  // Remove some and insert new ones.
+  for (int i = 0; i < 500; i += 3) EXPECT_TRUE(index.remove(ids[i]));
+  EXPECT_FALSE(index.remove(ids[0]));
+  EXPECT_FALSE(index.exists(ids[0]));
+  for (const auto& polygon : getRandomPolygons(50)) index.insert(polygon);
+  EXPECT_EQ(500u - 167u + 50u, index.size());
+
+  int nHits = 0;
+  std::vector<PolygonIndex::Id> containing;
+  for (int i = 0; i < 2000; ++i) {
+    const Position point(getRandom(-11.0, 11.0), getRandom(-11.0, 11.0));
+    const std::vector<PolygonIndex::Id> expected = getContaining(index, point);
+    EXPECT_EQ(!expected.empty(), index.getContaining(point, containing));
+    EXPECT_EQ(expected, containing);
+    nHits += containing.size();
+  }
+  EXPECT_GT(nHits, 500);
+}
+
+TEST(PolygonIndex, BoxQueries)
+{
+  srand(2);
+  PolygonIndex index(0.5);
+  index.insert(getRandomPolygons(300));
+
+  std::vector<PolygonIndex::Id> intersecting;
+  for (int i = 0; i < 300; ++i) {
+    const Position boxMin(getRandom(-11.0, 11.0), getRandom(-11.0, 11.0));
+    const Position boxMax = boxMin + Vector(getRandom(0.0, 2.0), getRandom(0.0, 2.0));
+    index.getIntersecting(boxMin, boxMax, intersecting);
+
+    // Compare with a dense sampling of the box.
+    for (PolygonIndex::Id id = 0; id < index.size(); ++id) {
+      const Polygon& polygon = index.getPolygon(id);
+      bool isIntersecting = false;
+      for (int x = 0; x <= 20 && !isIntersecting; ++x) {
+        for (int y = 0; y <= 20 && !isIntersecting; ++y) {
+          const Position point = boxMin + Vector(x / 20.0 * (boxMax - boxMin).x(), y / 20.0 * (boxMax - boxMin).y());
+          isIntersecting = polygon.isInside(point);
+        }
+      }
+      for (const auto& vertex : polygon.getVertices()) {
+        isIntersecting |= (vertex.array() >= boxMin.array()).all() && (vertex.array() <= boxMax.array()).all();
+      }
+      const bool isFound = std::binary_search(intersecting.begin(), intersecting.end(), id);
+      // The sampling can miss thin overlaps, but never finds ones which do not exist.
+      if (isIntersecting) {
+        EXPECT_TRUE(isFound) << id;
+      }
+    }
+  }
+
+  // Box inside a polygon, without vertices or edges in the box.
+  PolygonIndex single(0.1);
+  const PolygonIndex::Id id = single.insert(Polygon::fromCircle(Position(1.0, 1.0), 2.0, 9));
+  EXPECT_TRUE(single.getIntersecting(Position(0.9, 0.9), Position(1.1, 1.1), intersecting));
+  EXPECT_EQ(std::vector<PolygonIndex::Id>({id}), intersecting);
+  EXPECT_FALSE(single.getIntersecting(Position(3.1, 3.1), Position(3.2, 3.2), intersecting));
+  EXPECT_FALSE(single.getIntersecting(Position(-1.0, 2.9), Position(-0.4, 3.0), intersecting));
+  EXPECT_TRUE(single.getIntersecting(Position(-10.0, -10.0), Position(10.0, 10.0), intersecting));
+  single.clear();
+  EXPECT_EQ(0u, single.size());
+  EXPECT_FALSE(single.getContaining(Position(1.0, 1.0), intersecting));
+}
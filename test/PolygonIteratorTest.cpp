@@ -7,6 +7,7 @@
  */
 
 #include "grid_map/iterators/PolygonIterator.hpp"
+#include "grid_map/iterators/SubmapIterator.hpp"
 #include "grid_map/GridMap.hpp"
 #include "grid_map/Polygon.hpp"
 
@@ -16,6 +17,11 @@
 // gtest
 #include <gtest/gtest.h>
 
+// STL
+#include <cmath>
+#include <memory>
+#include <vector>
+
 // Limits
 #include <cfloat>
 
@@ -193,3 +199,103 @@ TEST(PolygonIterator, MoveMap)
   ++iterator;
   EXPECT_TRUE(iterator.isPastEnd());
 }
+
+TEST(PolygonIterator, Spans)
+{
+  GridMap map({"iterator", "spans"});
+  map.setGeometry(Length(8.0, 5.0), 1.0, Position(0.0, 0.0)); // bufferSize(8, 5)
+  map.move(Position(2.0, 1.0));
+  map["iterator"].setZero();
+  map["spans"].setZero();
+
+  Polygon polygon;
+  polygon.addVertex(Position(5.1, 3.2));
+  polygon.addVertex(Position(-1.3, 2.1));
+  polygon.addVertex(Position(0.4, -1.4));
+  PolygonIterator iterator(map, polygon);
+
+  std::vector<Span> spans;
+  iterator.getSpans(spans);
+  for (; !iterator.isPastEnd(); ++iterator) {
+    map.at("iterator", *iterator) += 1;
+  }
+  for (const auto& span : spans) {
+    EXPECT_GT(span.length, 0);
+    span.segment(map["spans"]).array() += 1;
+  }
+  EXPECT_GT(map["iterator"].cast<int>().sum(), 0);
+  EXPECT_TRUE((map["iterator"].array() == map["spans"].array()).all());
+}
+
+TEST(PolygonIterator, InsideCellsInOrder)
+{
+  GridMap map({"types"});
+  map.setGeometry(Length(8.0, 5.0), 0.1, Position(0.0, 0.0));
+  map.move(Position(-1.23, 0.57));
+
+  // Star with more vertices than stored inline, and a self-intersecting bow tie.
+  grid_map::Polygon star;
+  for (int i = 0; i < 40; ++i) {
+    const double radius = (i % 2 == 0) ? 2.1 : 0.9;
+    const double angle = 2.0 * M_PI * i / 40;
+    star.addVertex(Position(-1.0, 0.5) + radius * Vector2d(cos(angle), sin(angle)));
+  }
+  const grid_map::Polygon bowTie({Position(-3.0, -1.0), Position(0.0, 2.0), Position(0.0, -1.0), Position(-3.0, 2.0)});
+
+  for (const auto& polygon : {star, bowTie}) {
+    std::vector<grid_map::Index> expected;
+    for (SubmapIterator iterator(map, map.getStartIndex(), map.getSize()); !iterator.isPastEnd(); ++iterator) {
+      Position position;
+      map.getPosition(*iterator, position);
+      if (polygon.isInside(position)) expected.push_back(*iterator);
+    }
+    std::vector<grid_map::Index> cells;
+    for (PolygonIterator iterator(map, polygon); !iterator.isPastEnd(); ++iterator) {
+      cells.push_back(*iterator);
+    }
+    ASSERT_FALSE(expected.empty());
+    ASSERT_EQ(expected.size(), cells.size());
+    for (size_t i = 0; i < cells.size(); ++i) {
+      EXPECT_EQ(expected[i](0), cells[i](0));
+      EXPECT_EQ(expected[i](1), cells[i](1));
+    }
+  }
+}
+
+TEST(PolygonIterator, CopyContinuesIteration)
+{
+  GridMap map({"types"});
+  map.setGeometry(Length(8.0, 5.0), 0.1, Position(0.0, 0.0));
+  const grid_map::Polygon polygon({Position(-1.0, -1.0), Position(1.5, 0.2), Position(-0.5, 1.5)});
+  PolygonIterator iterator(map, polygon);
+  for (int i = 0; i < 37; ++i) ++iterator;
+  PolygonIterator copy(iterator);
+  for (; !iterator.isPastEnd(); ++iterator, ++copy) {
+    ASSERT_FALSE(copy.isPastEnd());
+    EXPECT_TRUE((*iterator == *copy).all());
+  }
+  EXPECT_TRUE(copy.isPastEnd());
+}
+
+TEST(PolygonIterator, CopiesPolygonAndGeometry)
+{
+  GridMap map({"types"});
+  map.setGeometry(Length(8.0, 5.0), 0.1, Position(0.0, 0.0));
+  const std::vector<Position> vertices{Position(-2.0, -1.5), Position(1.5, -1.0), Position(0.5, 2.0)};
+  std::vector<grid_map::Index> expected;
+  const grid_map::Polygon polygon(vertices);
+  for (PolygonIterator iterator(map, polygon); !iterator.isPastEnd(); ++iterator) {
+    expected.push_back(*iterator);
+  }
+
+  // A temporary polygon, and moving or destroying the map, do not change the cells.
+  std::unique_ptr<GridMap> movedMap(new GridMap(map));
+  PolygonIterator iterator(*movedMap, grid_map::Polygon(vertices));
+  movedMap->move(Position(1.5, -1.0));
+  movedMap.reset();
+  std::vector<grid_map::Index> cells;
+  for (; !iterator.isPastEnd(); ++iterator) cells.push_back(*iterator);
+  ASSERT_FALSE(expected.empty());
+  ASSERT_EQ(expected.size(), cells.size());
+  for (size_t i = 0; i < cells.size(); ++i) EXPECT_TRUE((expected[i] == cells[i]).all());
+}
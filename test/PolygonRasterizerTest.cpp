@@ -0,0 +1,109 @@
+/*
+ * PolygonRasterizerTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map/PolygonRasterizer.hpp"
+#include "grid_map/GridMap.hpp"
+#include "grid_map/Polygon.hpp"
+#include "grid_map/iterators/GridMapIterator.hpp"
+#include "grid_map/iterators/PolygonIterator.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+// STL
+#include <cmath>
+#include <vector>
+
+using namespace std;
+using namespace grid_map;
+
+namespace {
+
+//! Checks spans, row spans and the iterator against the inside test at every cell center.
+void checkAgainstBruteForce(GridMap& map, const Polygon& polygon)
+{
+  map.add("expected", 0);
+  map.add("spans", 0);
+  map.add("iterator", 0);
+  for (GridMapIterator iterator(map); !iterator.isPastEnd(); ++iterator) {
+    Position position;
+    map.getPosition(*iterator, position);
+    if (polygon.isInside(position)) map.at("expected", *iterator) = 1;
+  }
+
+  PolygonRasterizer rasterizer(map);
+  std::vector<Span> spans;
+  rasterizer.getSpans(polygon, spans);
+  for (const auto& span : spans) {
+    EXPECT_GT(span.length, 0);
+    EXPECT_LE(span.rowStart + span.length, map.getSize()(0));
+    span.segment(map["spans"]).array() += 1;
+  }
+
+  for (PolygonIterator iterator(map, polygon); !iterator.isPastEnd(); ++iterator) {
+    map.at("iterator", *iterator) += 1;
+  }
+
+  EXPECT_TRUE((map["spans"].array() == map["expected"].array()).all());
+  EXPECT_TRUE((map["iterator"].array() == map["expected"].array()).all());
+}
+
+} // namespace
+
+TEST(PolygonRasterizer, Triangle)
+{
+  GridMap map({"layer"});
+  map.setGeometry(Length(8.0, 5.0), 0.1, Position(0.0, 0.0));
+  Polygon polygon({Position(3.1, 2.2), Position(-3.7, 0.3), Position(1.05, -2.35)});
+  checkAgainstBruteForce(map, polygon);
+}
+
+TEST(PolygonRasterizer, ConcaveOnMovedMap)
+{
+  GridMap map({"layer"});
+  map.setGeometry(Length(6.0, 6.0), 0.05, Position(0.0, 0.0));
+  map.move(Position(1.23, -2.71));
+  Polygon polygon;
+  for (int i = 0; i < 16; ++i) {
+    const double angle = 2.0 * M_PI * i / 16;
+    const double radius = (i % 2 == 0) ? 2.9 : 0.8; // Star.
+    polygon.addVertex(Position(1.0 + radius * cos(angle), -2.5 + radius * sin(angle)));
+  }
+  checkAgainstBruteForce(map, polygon);
+}
+
+TEST(PolygonRasterizer, ThinDiagonalCorridor)
+{
+  GridMap map({"layer"});
+  map.setGeometry(Length(10.0, 10.0), 0.1, Position(0.0, 0.0));
+  map.move(Position(-0.35, 0.45));
+  Polygon polygon({Position(-4.0, -4.2), Position(-3.8, -4.2), Position(4.2, 3.9), Position(4.0, 3.9)});
+  checkAgainstBruteForce(map, polygon);
+}
+
+TEST(PolygonRasterizer, CellCentersOnEdges)
+{
+  GridMap map({"layer"});
+  map.setGeometry(Length(8.0, 5.0), 1.0, Position(0.0, 0.0)); // Cell centers at x.5.
+  Polygon polygon({Position(2.5, 1.5), Position(-1.5, 1.5), Position(-1.5, -0.5), Position(2.5, -0.5)});
+  checkAgainstBruteForce(map, polygon);
+}
+
+TEST(PolygonRasterizer, FillPolygon)
+{
+  GridMap map({"layer"});
+  map.setGeometry(Length(8.0, 5.0), 0.1, Position(0.0, 0.0));
+  map.move(Position(0.75, 0.35));
+  map["layer"].setZero();
+  Polygon polygon({Position(3.1, 2.2), Position(-3.7, 0.3), Position(1.05, -2.35)});
+  map.fillPolygon("layer", polygon, 7);
+
+  for (GridMapIterator iterator(map); !iterator.isPastEnd(); ++iterator) {
+    Position position;
+    map.getPosition(*iterator, position);
+    EXPECT_EQ(polygon.isInside(position) ? 7 : 0, map.at("layer", *iterator));
+  }
+}
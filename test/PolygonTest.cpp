@@ -230,3 +230,47 @@ TEST(triangulation, rectangle)
   ASSERT_EQ(2, polygons.size());
   // TODO Extend.
 }
+
+TEST(Polygon, isConvex)
+{
+  EXPECT_TRUE(Polygon({Vector2d(0.0, 0.0), Vector2d(1.0, 0.0), Vector2d(0.5, 1.0)}).isConvex());
+  EXPECT_TRUE(Polygon({Vector2d(0.0, 0.0), Vector2d(0.0, 1.0), Vector2d(1.0, 1.0), Vector2d(1.0, 0.0)}).isConvex());
+  EXPECT_TRUE(Polygon({Vector2d(0.0, 0.0), Vector2d(0.5, 0.0), Vector2d(1.0, 0.0), Vector2d(0.5, 1.0)}).isConvex());
+  EXPECT_FALSE(Polygon({Vector2d(0.0, 0.0), Vector2d(1.0, 0.0), Vector2d(0.5, 0.2), Vector2d(0.5, 1.0)}).isConvex());
+  EXPECT_FALSE(Polygon({Vector2d(0.0, 0.0), Vector2d(1.0, 1.0), Vector2d(1.0, 0.0), Vector2d(0.0, 1.0)}).isConvex());
+  // Pentagram, all turns in the same direction but winding twice.
+  Polygon pentagram;
+  for (int i = 0; i < 5; ++i) pentagram.addVertex(Vector2d(cos(4.0 * M_PI * i / 5.0), sin(4.0 * M_PI * i / 5.0)));
+  EXPECT_FALSE(pentagram.isConvex());
+  EXPECT_FALSE(Polygon({Vector2d(0.0, 0.0), Vector2d(1.0, 0.0)}).isConvex());
+}
+
+TEST(Polygon, isInsideBatch)
+{
+  Polygon star;
+  for (int i = 0; i < 24; ++i) {
+    const double radius = i % 2 == 0 ? 1.0 : 0.4;
+    star.addVertex(Vector2d(0.3 + radius * cos(M_PI * i / 12.0), -0.2 + radius * sin(M_PI * i / 12.0)));
+  }
+  const Polygon hexagon = Polygon::fromCircle(Position(0.3, -0.2), 0.9, 6);
+  ASSERT_FALSE(star.isConvex());
+  ASSERT_TRUE(hexagon.isConvex());
+
+  srand(1);
+  const Matrix2Xd points = 1.5 * Matrix2Xd::Random(2, 1000);
+  for (const Polygon& polygon : {star, hexagon}) {
+    Array<bool, Dynamic, 1> isInside;
+    const size_t nInside = polygon.isInside(points, isInside);
+    ASSERT_EQ(points.cols(), isInside.size());
+    EXPECT_EQ(isInside.count(), nInside);
+    EXPECT_GT(nInside, 100u);
+    for (int i = 0; i < points.cols(); ++i) {
+      EXPECT_EQ(polygon.isInside(Position(points.col(i))), isInside(i)) << i;
+    }
+  }
+
+  Array<bool, Dynamic, 1> isInside;
+  EXPECT_EQ(0u, Polygon().isInside(points, isInside));
+  EXPECT_EQ(points.cols(), isInside.size());
+  EXPECT_EQ(0u, star.isInside(Matrix2Xd(2, 0), isInside));
+}
@@ -0,0 +1,175 @@
+/*
+ * RayCasterTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map/RayCaster.hpp"
+#include "grid_map/iterators/LineIterator.hpp"
+#include "grid_map/GridMap.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+// STL
+#include <cmath>
+#include <utility>
+#include <vector>
+
+using namespace grid_map;
+
+namespace {
+
+std::vector<Position> getEndpoints(const Position& origin, const double range, const int nRays)
+{
+  std::vector<Position> endpoints;
+  for (int k = 0; k < nRays; ++k) {
+    const double angle = 2.0 * M_PI * k / nRays + 0.01;
+    endpoints.push_back(origin + range * Vector(std::cos(angle), std::sin(angle)));
+  }
+  return endpoints;
+}
+
+} // namespace
+
+TEST(RayCaster, BresenhamMatchesLineIterator)
+{
+  GridMap map({"layer"});
+  map.setGeometry(Length(8.0, 5.0), 0.1, Position(0.0, 0.0));
+  map.move(Position(-1.23, 0.57));
+  RayCaster rayCaster(map);
+
+  // Rays from inside the map, and rays starting outside of it (clipped at the border).
+  std::vector<std::pair<Position, Position>> rays;
+  for (const Position& origin : {Position(-1.0, 0.4), Position(4.1, 0.4), Position(-1.0, 4.3),
+                                Position(-6.2, -2.7), Position(3.3, 3.9)}) {
+    const double range = map.isInside(origin) ? 2.0 : 4.0;
+    for (const auto& end : getEndpoints(origin, range, 50)) rays.emplace_back(origin, end);
+  }
+  // Rays crossing the map with both ends outside.
+  rays.emplace_back(Position(-7.0, 0.33), Position(5.0, 1.21));
+  rays.emplace_back(Position(-0.77, -3.0), Position(-2.41, 4.5));
+
+  size_t nClipped = 0;
+  for (const auto& ray : rays) {
+    std::vector<grid_map::Index> cells;
+    const bool isCast = rayCaster.castRay(ray.first, ray.second, [&](const grid_map::Index& index) {
+      cells.push_back(index);
+      return true;
+    });
+    EXPECT_EQ(isCast, !cells.empty());
+    if (isCast && !map.isInside(ray.first)) ++nClipped;
+    size_t i = 0;
+    for (LineIterator iterator(map, ray.first, ray.second); !iterator.isPastEnd(); ++iterator, ++i) {
+      ASSERT_LT(i, cells.size());
+      EXPECT_TRUE((*iterator == cells[i]).all()) << ray.first.transpose() << " -> " << ray.second.transpose();
+    }
+    EXPECT_EQ(i, cells.size()) << ray.first.transpose() << " -> " << ray.second.transpose();
+  }
+  EXPECT_GT(nClipped, 20u);
+}
+
+TEST(RayCaster, ExactTraversal)
+{
+  GridMap map({"layer"});
+  map.setGeometry(Length(8.0, 5.0), 0.1, Position(0.0, 0.0));
+  map.move(Position(-1.23, 0.57));
+  RayCaster rayCaster(map, RayTraversal::EXACT);
+
+  const Position origin(-1.0, 0.4);
+  for (const auto& end : getEndpoints(origin, 5.0, 50)) {
+    std::vector<grid_map::Index> cells;
+    rayCaster.castRay(origin, end, [&](const grid_map::Index& index) {
+      cells.push_back(index);
+      return true;
+    });
+    ASSERT_FALSE(cells.empty());
+    grid_map::Index index;
+    map.getIndex(origin, index);
+    EXPECT_TRUE((cells.front() == index).all());
+
+    // 4-connected path.
+    for (size_t i = 1; i < cells.size(); ++i) {
+      const grid_map::Index step = (map.getIndexer().getIndexFromBufferIndex(cells[i])
+          - map.getIndexer().getIndexFromBufferIndex(cells[i - 1])).abs();
+      EXPECT_EQ(1, step.sum());
+    }
+
+    // All cells along the ray inside the map are visited.
+    for (double t = 0.0; t <= 1.0; t += 0.001) {
+      const Position position = origin + t * (end - origin);
+      if (!map.getIndex(position, index)) continue;
+      bool isVisited = false;
+      for (const auto& cell : cells) isVisited = isVisited || (cell == index).all();
+      EXPECT_TRUE(isVisited);
+    }
+  }
+}
+
+TEST(RayCaster, OutsideOfMap)
+{
+  GridMap map({"layer"});
+  map.setGeometry(Length(2.0, 2.0), 0.1, Position(0.0, 0.0));
+  RayCaster rayCaster(map);
+  int nCells = 0;
+  EXPECT_FALSE(rayCaster.castRay(Position(3.0, 3.0), Position(5.0, 3.0), [&](const grid_map::Index&) {
+    return ++nCells > 0;
+  }));
+  EXPECT_EQ(0, nCells);
+
+  // A ray crossing the map is clipped.
+  EXPECT_TRUE(rayCaster.castRay(Position(-3.0, 0.05), Position(3.0, 0.05), [&](const grid_map::Index&) {
+    return ++nCells > 0;
+  }));
+  EXPECT_EQ(20, nCells);
+}
+
+TEST(RayCaster, Reductions)
+{
+  GridMap map({"layer"});
+  map.setGeometry(Length(8.0, 5.0), 0.1, Position(0.0, 0.0));
+  map.move(Position(-1.23, 0.57));
+  map["layer"].setZero();
+  map.atPosition("layer", Position(-0.5, 0.4)) = 254;
+  map.atPosition("layer", Position(-0.2, 0.4)) = 100;
+
+  const Position origin(-1.0, 0.4);
+  std::vector<Position> endpoints = getEndpoints(origin, 2.0, 1000);
+  endpoints.push_back(Position(1.0, 0.4));
+
+  for (const unsigned int nThreads : {1u, 4u}) {
+    RayCaster rayCaster(map);
+    rayCaster.setNumberOfThreads(nThreads);
+    std::vector<DataType> maxValues;
+    std::vector<double> sums;
+    std::vector<grid_map::Index> hits;
+    rayCaster.getMaxValues(map["layer"], origin, endpoints, maxValues);
+    rayCaster.getValueSums(map["layer"], origin, endpoints, sums);
+    const size_t nHits = rayCaster.getFirstHits(map["layer"], origin, endpoints, 100, hits);
+    ASSERT_EQ(endpoints.size(), maxValues.size());
+    EXPECT_EQ(254, maxValues.back());
+    EXPECT_DOUBLE_EQ(354.0, sums.back());
+    grid_map::Index obstacle;
+    map.getIndex(Position(-0.5, 0.4), obstacle);
+    EXPECT_TRUE((hits.back() == obstacle).all());
+
+    size_t nExpectedHits = 0;
+    for (size_t i = 0; i < endpoints.size(); ++i) {
+      std::vector<DataType> values;
+      rayCaster.castRay(origin, endpoints[i], [&](const grid_map::Index& index) {
+        values.push_back(map.at("layer", index));
+        return true;
+      });
+      DataType maxValue = 0;
+      double sum = 0.0;
+      for (const auto value : values) {
+        maxValue = std::max(maxValue, value);
+        sum += value;
+      }
+      EXPECT_EQ(maxValue, maxValues[i]);
+      EXPECT_EQ(sum, sums[i]);
+      if (maxValue >= 100) ++nExpectedHits;
+    }
+    EXPECT_EQ(nExpectedHits, nHits);
+  }
+}
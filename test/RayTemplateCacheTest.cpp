@@ -0,0 +1,107 @@
+/*
+ * RayTemplateCacheTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map/RayTemplateCache.hpp"
+#include "grid_map/operators/MarkAndClear.hpp"
+#include "grid_map/iterators/LineIterator.hpp"
+#include "grid_map/GridMap.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+// STL
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace grid_map;
+
+namespace {
+
+std::vector<double> getAngles(const int nBeams)
+{
+  std::vector<double> angles;
+  for (int k = 0; k < nBeams; ++k) angles.push_back(2.0 * M_PI * k / nBeams + 0.001);
+  return angles;
+}
+
+} // namespace
+
+TEST(RayTemplateCache, MatchesLineIterator)
+{
+  GridMap map({"layer"});
+  map.setGeometry(Length(8.0, 5.0), 0.1, Position(0.0, 0.0));
+  map.move(Position(-1.23, 0.57));
+  grid_map::Index originBufferIndex;
+  map.getIndex(map.getPosition(), originBufferIndex);
+  Position origin;
+  map.getPosition(originBufferIndex, origin); // Cell center.
+  const grid_map::Index originIndex = map.getIndexer().getIndexFromBufferIndex(originBufferIndex);
+
+  RayTemplateCache cache(getAngles(360), 1.5);
+  EXPECT_TRUE(cache.update(map.getResolution()));
+  EXPECT_FALSE(cache.update(map.getResolution()));
+  ASSERT_EQ(360u, cache.getNumberOfBeams());
+  for (size_t beam = 0; beam < cache.getNumberOfBeams(); ++beam) {
+    const Position end = origin + cache.getMaxRange() * Vector(std::cos(cache.getAngle(beam)), std::sin(cache.getAngle(beam)));
+    size_t i = 0;
+    for (LineIterator iterator(map, origin, end); !iterator.isPastEnd(); ++iterator, ++i) {
+      ASSERT_LT(i, cache.getRaySize(beam));
+      const grid_map::Index offset = map.getIndexer().getIndexFromBufferIndex(*iterator) - originIndex;
+      EXPECT_TRUE((offset == cache.getRayOffsets(beam)[i]).all());
+      Position position;
+      map.getPosition(*iterator, position);
+      EXPECT_NEAR((position - origin).dot(end - origin) / cache.getMaxRange(), cache.getRayDistances(beam)[i], 1e-5);
+    }
+    EXPECT_EQ(i, cache.getRaySize(beam));
+  }
+
+  // A change of the resolution rebuilds the templates.
+  const size_t raySize = cache.getRaySize(0);
+  EXPECT_TRUE(cache.update(0.05));
+  EXPECT_DOUBLE_EQ(0.05, cache.getResolution());
+  EXPECT_GT(cache.getRaySize(0), raySize);
+}
+
+TEST(RayTemplateCache, MarkAndClear)
+{
+  GridMap map({"obstacles"});
+  map.setGeometry(Length(8.0, 5.0), 0.1, Position(0.0, 0.0));
+  map.move(Position(-1.23, 0.57));
+  map["obstacles"].setConstant(NO_INFORMATION);
+  grid_map::Index originBufferIndex;
+  map.getIndex(map.getPosition() + Position(0.3, -0.2), originBufferIndex);
+  Position origin;
+  map.getPosition(originBufferIndex, origin);
+  RayTemplateCache cache(getAngles(720), 1.5);
+
+  // Without returns, the cells of the full templates are cleared.
+  GridMap expected = map;
+  for (size_t beam = 0; beam < cache.getNumberOfBeams(); ++beam) {
+    const Position end = origin + cache.getMaxRange() * Vector(std::cos(cache.getAngle(beam)), std::sin(cache.getAngle(beam)));
+    for (LineIterator iterator(map, origin, end); !iterator.isPastEnd(); ++iterator) {
+      expected.at("obstacles", *iterator) = FREE_SPACE;
+    }
+  }
+  MarkAndClear markAndClear;
+  std::vector<double> ranges(cache.getNumberOfBeams(), std::numeric_limits<double>::infinity());
+  EXPECT_TRUE(markAndClear("obstacles", origin, ranges, cache, map));
+  EXPECT_TRUE((map["obstacles"].array() == expected["obstacles"].array()).all());
+
+  // Returns are marked and the cells before them are cleared.
+  ranges.assign(cache.getNumberOfBeams(), 0.8);
+  ranges[0] = std::numeric_limits<double>::quiet_NaN();
+  map["obstacles"].setConstant(NO_INFORMATION);
+  EXPECT_TRUE(markAndClear("obstacles", origin, ranges, cache, map));
+  for (size_t beam = 1; beam < cache.getNumberOfBeams(); ++beam) {
+    const Vector direction(std::cos(cache.getAngle(beam)), std::sin(cache.getAngle(beam)));
+    EXPECT_EQ(LETHAL_OBSTACLE, map.atPosition("obstacles", origin + 0.8 * direction));
+    EXPECT_EQ(FREE_SPACE, map.atPosition("obstacles", origin + 0.6 * direction));
+    EXPECT_NE(FREE_SPACE, map.atPosition("obstacles", origin + 1.0 * direction));
+  }
+
+  EXPECT_THROW(markAndClear("obstacles", origin, std::vector<double>(3, 1.0), cache, map), std::invalid_argument);
+}
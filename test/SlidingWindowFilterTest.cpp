@@ -0,0 +1,127 @@
+/*
+ * SlidingWindowFilterTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map/SlidingWindowFilter.hpp"
+#include "grid_map/iterators/SlidingWindowIterator.hpp"
+#include "grid_map/iterators/GridMapIterator.hpp"
+#include "grid_map/GridMap.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+// STL
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+using namespace grid_map;
+
+namespace {
+
+typedef SlidingWindowIterator::EdgeHandling EdgeHandling;
+typedef SlidingWindowFilter::Statistic Statistic;
+
+GridMap getRandomMap()
+{
+  GridMap map({"layer"});
+  map.setGeometry(Length(3.7, 2.3), 0.1, Position(0.0, 0.0));
+  std::srand(2);
+  for (int i = 0; i < map["layer"].size(); ++i) map["layer"](i) = std::rand() % 256;
+  return map;
+}
+
+/*!
+ * Brute force reference from the window data of the sliding window iterator (CROP).
+ */
+void checkAgainstIterator(const EdgeHandling edgeHandling, const Statistic statistic, const size_t windowSize)
+{
+  GridMap map = getRandomMap();
+  map.add("result", 7);
+  SlidingWindowFilter filter(windowSize, edgeHandling);
+  filter.filter(map, "layer", "result", statistic);
+
+  const int margin = (windowSize - 1) / 2;
+  for (SlidingWindowIterator iterator(map, "layer", EdgeHandling::CROP, windowSize); !iterator.isPastEnd(); ++iterator) {
+    const Index index(*iterator);
+    const bool isComplete = (index >= margin).all() && (index < map.getSize() - margin).all();
+    const DataType value = map.at("result", index);
+    if (edgeHandling == EdgeHandling::INSIDE && !isComplete) {
+      EXPECT_EQ(7, value);
+      continue;
+    }
+    const Matrix data = iterator.getData();
+    switch (statistic) {
+      case Statistic::MIN:
+        EXPECT_EQ(data.minCoeff(), value) << index.transpose();
+        break;
+      case Statistic::MAX:
+        EXPECT_EQ(data.maxCoeff(), value) << index.transpose();
+        break;
+      case Statistic::MEAN:
+        EXPECT_EQ(std::round(data.cast<double>().mean()), value) << index.transpose();
+        break;
+      case Statistic::COUNT:
+        EXPECT_EQ(edgeHandling == EdgeHandling::MEAN ? windowSize * windowSize : data.size(), value);
+        break;
+    }
+  }
+}
+
+} // namespace
+
+TEST(SlidingWindowFilter, MatchesIterator)
+{
+  for (const auto edgeHandling : {EdgeHandling::INSIDE, EdgeHandling::CROP, EdgeHandling::EMPTY, EdgeHandling::MEAN}) {
+    for (const auto statistic : {Statistic::MIN, Statistic::MAX, Statistic::MEAN, Statistic::COUNT}) {
+      for (const size_t windowSize : {1, 3, 7, 15}) {
+        SCOPED_TRACE(windowSize);
+        checkAgainstIterator(edgeHandling, statistic, windowSize);
+      }
+    }
+  }
+}
+
+TEST(SlidingWindowFilter, WrappedBuffer)
+{
+  GridMap map = getRandomMap();
+  map.move(Position(-1.23, 0.57));
+  ASSERT_FALSE(map.isDefaultStartIndex());
+  for (const auto edgeHandling : {EdgeHandling::INSIDE, EdgeHandling::CROP, EdgeHandling::MEAN}) {
+    for (const auto statistic : {Statistic::MIN, Statistic::MAX, Statistic::MEAN, Statistic::COUNT}) {
+      map.add("result", 7);
+      GridMap unwrappedMap(map);
+      unwrappedMap.convertToDefaultStartIndex();
+      SlidingWindowFilter filter(5, edgeHandling);
+      filter.filter(map, "layer", "result", statistic);
+      filter.filter(unwrappedMap, "layer", "result", statistic);
+      for (GridMapIterator iterator(map); !iterator.isPastEnd(); ++iterator) {
+        EXPECT_EQ(unwrappedMap.at("result", iterator.getUnwrappedIndex()), map.at("result", *iterator));
+      }
+    }
+  }
+}
+
+TEST(SlidingWindowFilter, InPlaceAndNewLayer)
+{
+  GridMap map = getRandomMap();
+  SlidingWindowFilter filter(5);
+  filter.filter(map, "layer", "max", Statistic::MAX);
+  ASSERT_TRUE(map.exists("max"));
+  filter.filter(map, "layer", "layer", Statistic::MAX);
+  EXPECT_TRUE((map["layer"].array() == map["max"].array()).all());
+}
+
+TEST(SlidingWindowFilter, WindowLargerThanMap)
+{
+  GridMap map({"layer"});
+  map.setGeometry(Length(0.3, 0.2), 0.1, Position(0.0, 0.0));
+  map["layer"] << 1, 2, 3, 4, 5, 6;
+  SlidingWindowFilter filter(9);
+  filter.filter(map, "layer", "min", Statistic::MIN);
+  filter.filter(map, "layer", "mean", Statistic::MEAN);
+  EXPECT_TRUE((map["min"].array() == 1).all());
+  EXPECT_TRUE((map["mean"].array() == 4).all()); // round(3.5)
+}
@@ -138,3 +138,29 @@ TEST(SlidingWindowIterator, WindowSize3Inside)
   ++iterator;
   EXPECT_TRUE(iterator.isPastEnd());
 }
+
+TEST(SlidingWindowIterator, WrappedBuffer)
+{
+  GridMap map;
+  map.setGeometry(Length(8.1, 5.1), 1.0, Position(0.0, 0.0)); // bufferSize(8, 5)
+  map.add("layer");
+  map["layer"].setRandom();
+  map.move(Position(-3.0, 2.0));
+  ASSERT_FALSE(map.isDefaultStartIndex());
+  GridMap unwrappedMap(map);
+  unwrappedMap.convertToDefaultStartIndex();
+
+  for (const auto edgeHandling : {SlidingWindowIterator::EdgeHandling::INSIDE,
+      SlidingWindowIterator::EdgeHandling::CROP, SlidingWindowIterator::EdgeHandling::MEAN}) {
+    size_t nCells = 0;
+    for (SlidingWindowIterator iterator(map, "layer", edgeHandling, 3); !iterator.isPastEnd(); ++iterator) {
+      const Matrix data = iterator.getData();
+      SlidingWindowIterator unwrappedIterator(unwrappedMap, "layer", edgeHandling, 3);
+      while (!unwrappedIterator.isPastEnd() && (*unwrappedIterator != iterator.getUnwrappedIndex()).any()) ++unwrappedIterator;
+      ASSERT_FALSE(unwrappedIterator.isPastEnd());
+      EXPECT_TRUE((unwrappedIterator.getData().array() == data.array()).all());
+      ++nCells;
+    }
+    EXPECT_EQ(edgeHandling == SlidingWindowIterator::EdgeHandling::INSIDE ? 6 * 3 : 8 * 5, nCells);
+  }
+}
@@ -7,6 +7,8 @@
  */
 
 #include "grid_map/iterators/SpiralIterator.hpp"
+#include "grid_map/iterators/GridMapIterator.hpp"
+#include "grid_map/RingOffsetTable.hpp"
 #include "grid_map/GridMap.hpp"
 
 // Eigen
@@ -39,3 +41,77 @@ TEST(SpiralIterator, CenterOutOfMap)
 
   EXPECT_TRUE(map.isInside(iterator_position));
 }
+
+TEST(SpiralIterator, RingsInOrder)
+{
+  GridMap map( { "types" });
+  map.setGeometry(Length(8.0, 5.0), 0.5, Position(0.0, 0.0));
+  Position center(1.1, -0.3);
+  double radius = 2.0;
+  grid_map::Index centerIndex;
+  map.getIndex(center, centerIndex);
+
+  std::vector<grid_map::Index> cells;
+  for (SpiralIterator iterator(map, center, radius); !iterator.isPastEnd(); ++iterator) {
+    cells.push_back(*iterator);
+  }
+
+  // Each cell is visited once, ring by ring.
+  int lastRing = 0;
+  for (size_t i = 0; i < cells.size(); ++i) {
+    const int ring = static_cast<int>((cells[i] - centerIndex).cast<double>().matrix().norm());
+    EXPECT_GE(ring, lastRing);
+    lastRing = ring;
+    for (size_t j = 0; j < i; ++j) {
+      EXPECT_TRUE((cells[i] != cells[j]).any());
+    }
+  }
+
+  // All cells well inside the circle are visited.
+  for (GridMapIterator iterator(map); !iterator.isPastEnd(); ++iterator) {
+    Position position;
+    map.getPosition(*iterator, position);
+    if ((position - center).norm() > radius - map.getResolution()) continue;
+    bool isVisited = false;
+    for (const auto& cell : cells) isVisited = isVisited || (cell == *iterator).all();
+    EXPECT_TRUE(isVisited);
+  }
+}
+
+TEST(RingOffsetTable, SharedAndExtended)
+{
+  std::shared_ptr<const RingOffsetTable> small = RingOffsetTable::get(5);
+  EXPECT_GE(small->getNumberOfRings(), 5u);
+  EXPECT_EQ(small, RingOffsetTable::get(3));
+
+  std::shared_ptr<const RingOffsetTable> large = RingOffsetTable::get(small->getNumberOfRings() + 10);
+  ASSERT_EQ(small->getNumberOfRings() + 10, large->getNumberOfRings());
+  for (unsigned int ring = 0; ring <= large->getNumberOfRings(); ++ring) {
+    if (ring <= small->getNumberOfRings()) {
+      ASSERT_EQ(small->getRingSize(ring), large->getRingSize(ring));
+    }
+    for (size_t i = 0; i < large->getRingSize(ring); ++i) {
+      const grid_map::Index& offset = large->getRing(ring)[i];
+      EXPECT_EQ(ring, static_cast<unsigned int>(offset.cast<double>().matrix().norm()));
+      if (ring <= small->getNumberOfRings()) {
+        EXPECT_TRUE((offset == small->getRing(ring)[i]).all());
+      }
+    }
+  }
+}
+
+TEST(RingOffsetTable, CachedTableIsCapped)
+{
+  const unsigned int nRings = RingOffsetTable::maxCachedRings + 5;
+  std::shared_ptr<const RingOffsetTable> huge = RingOffsetTable::get(nRings);
+  EXPECT_EQ(nRings, huge->getNumberOfRings());
+  EXPECT_NE(huge, RingOffsetTable::get(nRings));
+
+  // The cache keeps the capped table, which is a prefix of the larger one.
+  std::shared_ptr<const RingOffsetTable> cached = RingOffsetTable::get(RingOffsetTable::maxCachedRings);
+  EXPECT_EQ(RingOffsetTable::maxCachedRings, cached->getNumberOfRings());
+  EXPECT_EQ(cached, RingOffsetTable::get(1));
+  for (unsigned int ring = 0; ring <= cached->getNumberOfRings(); ++ring) {
+    ASSERT_EQ(cached->getRingSize(ring), huge->getRingSize(ring));
+  }
+}
@@ -165,3 +165,33 @@ TEST(SubmapIterator, CircularBuffer)
   EXPECT_EQ(1, iterator.getSubmapIndex()(0));
   EXPECT_EQ(3, iterator.getSubmapIndex()(1));
 }
+
+TEST(SubmapIterator, Spans)
+{
+  GridMap map({"layer"});
+  map.setGeometry(Length(8.1, 5.1), 1.0, Position(0.0, 0.0)); // bufferSize(8, 5)
+  map.move(Position(-3.0, -2.0)); // bufferStartIndex(3, 2)
+  map.add("iterator", 0);
+  map.add("spans", 0);
+
+  // Submap crossing the wrap of the buffer in both directions.
+  SubmapIterator iterator(map, grid_map::Index(6, 3), grid_map::Size(4, 3));
+  std::vector<Span> spans;
+  iterator.getSpans(spans);
+  ASSERT_EQ(6, spans.size());
+  EXPECT_EQ(3, spans[0].column);
+  EXPECT_EQ(6, spans[0].rowStart);
+  EXPECT_EQ(2, spans[0].length);
+  EXPECT_EQ(3, spans[1].column);
+  EXPECT_EQ(0, spans[1].rowStart);
+  EXPECT_EQ(2, spans[1].length);
+  EXPECT_EQ(0, spans[4].column);
+
+  for (; !iterator.isPastEnd(); ++iterator) {
+    map.at("iterator", *iterator) += 1;
+  }
+  for (const auto& span : spans) {
+    span.segment(map["spans"]).array() += 1;
+  }
+  EXPECT_TRUE((map["iterator"].array() == map["spans"].array()).all());
+}
@@ -0,0 +1,85 @@
+/*
+ * TrajectoryEvaluatorTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "grid_map/operators/TrajectoryEvaluator.hpp"
+#include "grid_map/GridMap.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+// STL
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+using namespace grid_map;
+
+namespace {
+
+Eigen::Matrix3Xd getArc(const Position& start, const double velocity, const double yawRate, const int nPoses)
+{
+  Eigen::Matrix3Xd poses(3, nPoses);
+  Eigen::Vector3d pose(start.x(), start.y(), 0.0);
+  for (int i = 0; i < nPoses; ++i) {
+    poses.col(i) = pose;
+    pose += 0.1 * Eigen::Vector3d(velocity * std::cos(pose.z()), velocity * std::sin(pose.z()), yawRate);
+  }
+  return poses;
+}
+
+} // namespace
+
+TEST(TrajectoryEvaluator, MatchesFootprintChecker)
+{
+  GridMap map({"costs"});
+  map.setGeometry(Length(6.0, 6.0), 0.05, Position(0.0, 0.0));
+  map.move(Position(0.41, -0.27));
+  srand(1);
+  for (int i = 0; i < map["costs"].size(); ++i) map["costs"](i) = rand() % 200;
+  map.atPosition("costs", Position(1.5, 0.0)) = LETHAL_OBSTACLE;
+
+  const Polygon footprint({Position(0.3, 0.2), Position(0.3, -0.2), Position(-0.2, -0.2), Position(-0.2, 0.2)});
+  std::vector<Eigen::Matrix3Xd> trajectories;
+  for (int k = -5; k <= 5; ++k) trajectories.push_back(getArc(Position(0.0, 0.0), 0.5, 0.2 * k, 40));
+
+  for (const bool stopAtCollision : {true, false}) {
+    TrajectoryEvaluator evaluator(footprint);
+    evaluator.setStopAtCollision(stopAtCollision);
+    ThreadPool threadPool(3);
+    std::vector<TrajectoryCost> costs;
+    evaluator("costs", trajectories, map, costs, threadPool);
+    ASSERT_EQ(trajectories.size(), costs.size());
+
+    FootprintChecker checker(footprint);
+    int nCollisions = 0;
+    for (size_t k = 0; k < trajectories.size(); ++k) {
+      const Eigen::Matrix3Xd& trajectory = trajectories[k];
+      TrajectoryCost expected = {0, 0, -1, 0};
+      for (int i = 0; i < trajectory.cols(); ++i) {
+        const unsigned char cost = checker.getCost("costs", trajectory.col(i).head<2>(), trajectory(2, i), map);
+        expected.max_cost = std::max(expected.max_cost, cost);
+        expected.sum_cost += cost;
+        ++expected.number_of_poses;
+        if (cost >= LETHAL_OBSTACLE && expected.first_collision < 0) {
+          expected.first_collision = i;
+          if (stopAtCollision) break;
+        }
+      }
+      EXPECT_EQ(expected.max_cost, costs[k].max_cost);
+      EXPECT_EQ(expected.sum_cost, costs[k].sum_cost);
+      EXPECT_EQ(expected.first_collision, costs[k].first_collision);
+      EXPECT_EQ(expected.number_of_poses, costs[k].number_of_poses);
+      const TrajectoryCost single = evaluator("costs", trajectory, map);
+      EXPECT_EQ(costs[k].sum_cost, single.sum_cost);
+      if (costs[k].first_collision >= 0) ++nCollisions;
+    }
+    // The straight trajectory runs into the obstacle, the sharp turns avoid it.
+    EXPECT_GE(costs[5].first_collision, 0);
+    EXPECT_EQ(stopAtCollision ? costs[5].first_collision + 1 : 40, costs[5].number_of_poses);
+    EXPECT_EQ(-1, costs[0].first_collision);
+    EXPECT_LT(nCollisions, static_cast<int>(trajectories.size()));
+  }
+}